@@ -0,0 +1,167 @@
+#include "./BenchmarkHarness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  constexpr std::chrono::nanoseconds MIN_SAMPLE_TIME = std::chrono::milliseconds(1);
+  constexpr std::chrono::nanoseconds MAX_SAMPLE_SPAN = std::chrono::milliseconds(20);
+  constexpr std::uint64_t            MAX_BATCH_SIZE  = 1 << 20;
+  constexpr size_t                   SAMPLE_COUNT    = 15;
+
+  volatile double keptValue = 0;
+
+  /**
+   * Runs `batchSize` iterations and returns the time spent in `run` alone.
+   */
+  std::chrono::nanoseconds timeBatch(const Benchmark::Body &body,
+                                     const std::uint64_t    batchSize) {
+    if (!body.reset) {
+      const Clock::time_point start = Clock::now();
+      for (std::uint64_t iteration = 0; iteration < batchSize; iteration++) {
+        body.run();
+      }
+      return Clock::now() - start;
+    }
+
+    std::chrono::nanoseconds total{0};
+    for (std::uint64_t iteration = 0; iteration < batchSize; iteration++) {
+      body.reset();
+      const Clock::time_point start = Clock::now();
+      body.run();
+      total += Clock::now() - start;
+    }
+    return total;
+  }
+
+  std::string getKey(const std::string &name, const nlohmann::json &params) {
+    return name + params.dump();
+  }
+} // namespace
+
+namespace Benchmark {
+  Result runCase(const Case &benchmarkCase) {
+    const Body body = benchmarkCase.setup();
+
+    /*
+     * Calibrating doubles as the warm-up. Resets are not timed but still take wall time, so a
+     * cheap body behind an expensive reset settles for a shorter timed sample.
+     */
+    std::uint64_t batchSize = 1;
+    while (batchSize < MAX_BATCH_SIZE) {
+      const Clock::time_point        start = Clock::now();
+      const std::chrono::nanoseconds timed = timeBatch(body, batchSize);
+      if (timed >= MIN_SAMPLE_TIME || Clock::now() - start >= MAX_SAMPLE_SPAN) {
+        break;
+      }
+      batchSize *= 2;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(SAMPLE_COUNT);
+    for (size_t sample = 0; sample < SAMPLE_COUNT; sample++) {
+      const std::chrono::nanoseconds elapsed = timeBatch(body, batchSize);
+      samples.push_back(static_cast<double>(elapsed.count()) /
+                        static_cast<double>(batchSize));
+    }
+
+    std::ranges::sort(samples);
+    const double total = std::accumulate(samples.begin(), samples.end(), 0.0);
+
+    return {
+        .name       = benchmarkCase.name,
+        .params     = benchmarkCase.params,
+        .iterations = batchSize * SAMPLE_COUNT,
+        .medianNs   = samples[SAMPLE_COUNT / 2],
+        .meanNs     = total / static_cast<double>(SAMPLE_COUNT),
+        .minNs      = samples.front(),
+    };
+  }
+
+  void keep(const double value) {
+    keptValue = value;
+  }
+
+  nlohmann::json toJson(const std::vector<Result> &results) {
+    nlohmann::json benchmarks = nlohmann::json::array();
+    for (const Result &result : results) {
+      benchmarks.push_back({
+          {"name", result.name},
+          {"params", result.params},
+          {"iterations", result.iterations},
+          {"medianNs", result.medianNs},
+          {"meanNs", result.meanNs},
+          {"minNs", result.minNs},
+      });
+    }
+    return {{"benchmarks", benchmarks}};
+  }
+
+  std::vector<Result> fromJson(const nlohmann::json &json) {
+    std::vector<Result> results;
+    for (const nlohmann::json &benchmark : json.at("benchmarks")) {
+      results.push_back({
+          .name       = benchmark.at("name").get<std::string>(),
+          .params     = benchmark.at("params"),
+          .iterations = benchmark.at("iterations").get<std::uint64_t>(),
+          .medianNs   = benchmark.at("medianNs").get<double>(),
+          .meanNs     = benchmark.at("meanNs").get<double>(),
+          .minNs      = benchmark.at("minNs").get<double>(),
+      });
+    }
+    return results;
+  }
+
+  std::vector<Result> loadResults(const std::filesystem::path &path) {
+    std::ifstream file(path);
+    if (!file) {
+      throw std::runtime_error("Could not open " + path.string());
+    }
+
+    try {
+      return fromJson(nlohmann::json::parse(file));
+    } catch (const nlohmann::json::exception &error) {
+      throw std::runtime_error("Invalid benchmark results in " + path.string() + ": " +
+                               error.what());
+    }
+  }
+
+  size_t compare(const std::vector<Result> &results,
+                 const std::vector<Result> &baseline,
+                 const double               thresholdPercent) {
+    std::unordered_map<std::string, const Result *> baselineByKey;
+    for (const Result &result : baseline) {
+      baselineByKey[getKey(result.name, result.params)] = &result;
+    }
+
+    size_t regressions = 0;
+    for (const Result &result : results) {
+      const auto found = baselineByKey.find(getKey(result.name, result.params));
+      if (found == baselineByKey.end() || found->second->medianNs <= 0) {
+        continue;
+      }
+
+      const double baselineNs = found->second->medianNs;
+      const double change     = (result.medianNs - baselineNs) / baselineNs * 100.0;
+      const bool   regressed  = change > thresholdPercent;
+      regressions += regressed ? 1 : 0;
+
+      std::fprintf(stderr,
+                   "%-40s %-48s %12.1f ns -> %12.1f ns %+7.1f%%%s\n",
+                   result.name.c_str(),
+                   result.params.dump().c_str(),
+                   baselineNs,
+                   result.medianNs,
+                   change,
+                   regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+  }
+} // namespace Benchmark
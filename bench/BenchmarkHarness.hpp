@@ -0,0 +1,73 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Benchmark {
+  /**
+   * The code a benchmark times. When `reset` is set, it runs untimed before every iteration
+   * to restore whatever state `run` consumes, and each iteration is timed on its own.
+   * Otherwise iterations are timed in batches.
+   */
+  struct Body {
+    std::function<void()> run;
+    std::function<void()> reset = nullptr;
+  };
+
+  /**
+   * A benchmark and one combination of its parameters. `setup` builds the fixture, untimed,
+   * and returns the code to time; the fixture lives as long as the returned closures.
+   */
+  struct Case {
+    std::string           name;
+    nlohmann::json        params;
+    std::function<Body()> setup;
+  };
+
+  struct Result {
+    std::string    name;
+    nlohmann::json params;
+    std::uint64_t  iterations = 0;
+    double         medianNs   = 0;
+    double         meanNs     = 0;
+    double         minNs      = 0;
+  };
+
+  /**
+   * Times a case: batches are grown until a sample takes at least a millisecond, then a
+   * fixed number of samples is taken and summarized per iteration.
+   */
+  Result runCase(const Case &benchmarkCase);
+
+  /**
+   * Stores a result where the compiler cannot see it go unused, so that the work producing it
+   * is not optimized away.
+   */
+  void keep(double value);
+
+  nlohmann::json      toJson(const std::vector<Result> &results);
+  std::vector<Result> fromJson(const nlohmann::json &json);
+
+  /**
+   * Reads results written by `toJson`.
+   *
+   * @throws std::runtime_error if the file cannot be read or is not valid JSON.
+   */
+  std::vector<Result> loadResults(const std::filesystem::path &path);
+
+  /**
+   * Prints the change in median time of every result that has a baseline with the same name
+   * and parameters.
+   *
+   * @param thresholdPercent How much slower than the baseline a result may be.
+   * @returns The number of results slower than the baseline by more than the threshold.
+   */
+  size_t compare(const std::vector<Result> &results,
+                 const std::vector<Result> &baseline,
+                 double                     thresholdPercent);
+} // namespace Benchmark
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "./BenchmarkHarness.hpp"
+
+#include <filesystem>
+#include <vector>
+
+class ClientBenchmarkContext;
+
+namespace Benchmarks {
+  /**
+   * Benchmarks of the simulation core: the entity manager, the main scene systems and the
+   * helpers they are built on. Each fixture loads its own copy of the configuration.
+   */
+  std::vector<Benchmark::Case> getCoreCases(const std::filesystem::path &configPath);
+
+  /**
+   * Benchmarks of the SDL client code, run against the context's dummy drivers.
+   */
+  std::vector<Benchmark::Case> getClientCases(ClientBenchmarkContext &context);
+} // namespace Benchmarks
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../includes/AssetManagement/FontManager.hpp"
+#include "../includes/Configuration/Config.hpp"
+#include "../includes/GameEngine/JobSystem.hpp"
+#include "../includes/SystemManagement/AudioManager.hpp"
+#include "../includes/SystemManagement/SoftwareRenderer.hpp"
+#include "../includes/SystemManagement/TextRenderer.hpp"
+
+#include <SDL2/SDL.h>
+#include <memory>
+
+/**
+ * The SDL state the client benchmarks run against: a hidden window with a software renderer
+ * on the dummy video driver, the game's fonts and their glyph atlases, its audio on the
+ * dummy audio driver, and the engine's software render backend presenting to the window.
+ * Nothing is shown or played, so the benchmarks run the same on headless machines.
+ */
+class ClientBenchmarkContext {
+  SDL_Window                       *m_window   = nullptr;
+  SDL_Renderer                     *m_renderer = nullptr;
+  std::unique_ptr<FontManager>      m_fontManager;
+  std::unique_ptr<TextRenderer>     m_textRenderer;
+  std::unique_ptr<AudioManager>     m_audioManager;
+  std::unique_ptr<JobSystem>        m_jobSystem;
+  std::unique_ptr<SoftwareRenderer> m_softwareRenderer;
+
+  void cleanup();
+
+public:
+  /**
+   * @throws std::runtime_error if SDL, the renderer, the fonts or the audio cannot be set up.
+   */
+  explicit ClientBenchmarkContext(const GameConfig &gameConfig);
+  ~ClientBenchmarkContext();
+
+  ClientBenchmarkContext(const ClientBenchmarkContext &)            = delete;
+  ClientBenchmarkContext &operator=(const ClientBenchmarkContext &) = delete;
+
+  SDL_Renderer     *getRenderer() const;
+  TTF_Font         *getFont() const;
+  TextRenderer     &getTextRenderer() const;
+  AudioManager     &getAudioManager() const;
+  SoftwareRenderer &getSoftwareRenderer() const;
+};
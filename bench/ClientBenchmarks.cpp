@@ -0,0 +1,266 @@
+#include "../includes/AssetManagement/AudioSampleQueue.hpp"
+#include "../includes/SystemManagement/RenderBatcher.hpp"
+#include "./Benchmarks.hpp"
+#include "./ClientBenchmarkContext.hpp"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+  constexpr std::array<size_t, 4> QUEUED_SAMPLE_COUNTS = {1, 4, 16, 64};
+  constexpr std::array<size_t, 3> TEXT_LENGTHS         = {8, 32, 128};
+  constexpr std::array<size_t, 3> QUAD_COUNTS          = {1000, 10000, 50000};
+
+  constexpr std::array<std::string_view, 2> RENDER_BACKENDS = {"sdl", "software"};
+
+  constexpr std::array<AudioSample, 5> QUEUED_SAMPLES = {
+      AudioSample::SHOOT,
+      AudioSample::BULLET_HIT_01,
+      AudioSample::ENEMY_COLLISION,
+      AudioSample::ITEM_ACQUIRED,
+      AudioSample::SPEED_BOOST,
+  };
+
+  constexpr std::array<AudioSamplePriority, 4> QUEUED_PRIORITIES = {
+      AudioSamplePriority::BACKGROUND,
+      AudioSamplePriority::STANDARD,
+      AudioSamplePriority::IMPORTANT,
+      AudioSamplePriority::CRITICAL,
+  };
+
+  void addAudioCases(std::vector<Benchmark::Case> &cases, ClientBenchmarkContext &context) {
+    for (const size_t queuedCount : QUEUED_SAMPLE_COUNTS) {
+      // A fresh queue every iteration, so no sample is held back by its replay cooldown.
+      cases.push_back({
+          .name   = "AudioSampleQueue::update",
+          .params = {{"queuedSamples", queuedCount}},
+          .setup  = [&context, queuedCount]() -> Benchmark::Body {
+            const auto queue = std::make_shared<std::optional<AudioSampleQueue>>();
+            return {
+                .run   = [queue]() -> void { (*queue)->update(); },
+                .reset =
+                    [&context, queuedCount, queue]() -> void {
+                      queue->emplace(context.getAudioManager());
+                      for (size_t index = 0; index < queuedCount; index++) {
+                        (*queue)->queueSample(
+                            QUEUED_SAMPLES[index % QUEUED_SAMPLES.size()],
+                            QUEUED_PRIORITIES[index % QUEUED_PRIORITIES.size()]);
+                      }
+                    },
+            };
+          },
+      });
+    }
+  }
+
+  void addTextCases(std::vector<Benchmark::Case> &cases, ClientBenchmarkContext &context) {
+    for (const size_t length : TEXT_LENGTHS) {
+      cases.push_back({
+          .name   = "TextRenderer::renderLine",
+          .params = {{"textLength", length}},
+          .setup  = [&context, length]() -> Benchmark::Body {
+            std::string text;
+            for (size_t index = 0; index < length; index++) {
+              text += static_cast<char>('A' + index % 26);
+            }
+
+            return {.run = [&context, text]() -> void {
+              constexpr SDL_Color TEXT_COLOR = {.r = 255, .g = 255, .b = 255, .a = 255};
+              TextRenderer &textRenderer = context.getTextRenderer();
+              textRenderer.renderLine(context.getFont(), text, TEXT_COLOR, Vec2(0, 0));
+              textRenderer.flush();
+            }};
+          },
+      });
+    }
+  }
+
+  struct BenchmarkQuad {
+    SDL_Rect  rect;
+    SDL_Color color;
+  };
+
+  /**
+   * Boxes the sizes of the game's entities scattered over the output, a third of them faded
+   * out part way as entities are over their lifespans.
+   */
+  std::vector<BenchmarkQuad> createQuads(SDL_Renderer *renderer, const size_t count) {
+    int width  = 0;
+    int height = 0;
+    SDL_GetRendererOutputSize(renderer, &width, &height);
+
+    std::mt19937                       random(count);
+    std::uniform_int_distribution<int> size(15, 100);
+    std::uniform_int_distribution<int> x(0, width);
+    std::uniform_int_distribution<int> y(0, height);
+    std::uniform_int_distribution<int> channel(0, 255);
+
+    std::vector<BenchmarkQuad> quads(count);
+    for (size_t index = 0; index < count; index++) {
+      const int  side  = size(random);
+      const int  left  = x(random) - side / 2;
+      const int  top   = y(random) - side / 2;
+      const auto alpha = static_cast<Uint8>(index % 3 == 0 ? channel(random) : 255);
+
+      quads[index] = {
+          .rect  = {.x = left, .y = top, .w = side, .h = side},
+          .color = {.r = static_cast<Uint8>(channel(random)),
+                    .g = static_cast<Uint8>(channel(random)),
+                    .b = static_cast<Uint8>(channel(random)),
+                    .a = alpha},
+      };
+    }
+    return quads;
+  }
+
+  void addRenderCases(std::vector<Benchmark::Case> &cases, ClientBenchmarkContext &context) {
+    for (const std::string_view backend : RENDER_BACKENDS) {
+      for (const size_t quadCount : QUAD_COUNTS) {
+        // A whole frame: clearing, drawing the quads in one batch and presenting, so both
+        // backends pay for getting the frame to the window.
+        cases.push_back({
+            .name   = "Render frame",
+            .params = {{"backend", backend}, {"quads", quadCount}},
+            .setup  = [&context, backend, quadCount]() -> Benchmark::Body {
+              SoftwareRenderer *softwareRenderer =
+                  backend == "software" ? &context.getSoftwareRenderer() : nullptr;
+              const auto batcher = std::make_shared<RenderBatcher>(softwareRenderer);
+              const auto quads   = std::make_shared<std::vector<BenchmarkQuad>>(
+                  createQuads(context.getRenderer(), quadCount));
+
+              return {.run = [&context, softwareRenderer, batcher, quads]() -> void {
+                SDL_Renderer       *renderer = context.getRenderer();
+                constexpr SDL_Color BLACK    = {.r = 0, .g = 0, .b = 0, .a = 255};
+                if (softwareRenderer != nullptr) {
+                  softwareRenderer->clear(BLACK);
+                } else {
+                  SDL_SetRenderDrawColor(renderer, BLACK.r, BLACK.g, BLACK.b, BLACK.a);
+                  SDL_RenderClear(renderer);
+                }
+
+                for (const BenchmarkQuad &quad : *quads) {
+                  batcher->addQuad(quad.rect, quad.color);
+                }
+                batcher->flush(renderer);
+
+                if (softwareRenderer != nullptr) {
+                  softwareRenderer->present();
+                } else {
+                  SDL_RenderPresent(renderer);
+                }
+              }};
+            },
+        });
+      }
+    }
+  }
+} // namespace
+
+ClientBenchmarkContext::ClientBenchmarkContext(const GameConfig &gameConfig) {
+  SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+  SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+
+  if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+    throw std::runtime_error(std::string("SDL_Init failed: ") + SDL_GetError());
+  }
+
+  m_window = SDL_CreateWindow("yerb_bench",
+                              SDL_WINDOWPOS_UNDEFINED,
+                              SDL_WINDOWPOS_UNDEFINED,
+                              static_cast<int>(gameConfig.windowSize.x),
+                              static_cast<int>(gameConfig.windowSize.y),
+                              SDL_WINDOW_HIDDEN);
+  if (m_window == nullptr) {
+    cleanup();
+    throw std::runtime_error(std::string("SDL_CreateWindow failed: ") + SDL_GetError());
+  }
+
+  m_renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_SOFTWARE);
+  if (m_renderer == nullptr) {
+    cleanup();
+    throw std::runtime_error(std::string("SDL_CreateRenderer failed: ") + SDL_GetError());
+  }
+
+  m_fontManager = std::make_unique<FontManager>(gameConfig.fontPath);
+  if (m_fontManager->getFontMd() == nullptr) {
+    cleanup();
+    throw std::runtime_error("Could not load the font " + gameConfig.fontPath.string());
+  }
+
+  try {
+    m_textRenderer = std::make_unique<TextRenderer>(m_renderer, *m_fontManager);
+  } catch (const std::runtime_error &) {
+    cleanup();
+    throw;
+  }
+
+  try {
+    m_audioManager = std::make_unique<AudioManager>();
+  } catch (const std::runtime_error &) {
+    cleanup();
+    throw;
+  }
+
+  m_jobSystem        = std::make_unique<JobSystem>();
+  m_softwareRenderer = std::make_unique<SoftwareRenderer>(m_renderer, *m_jobSystem);
+}
+
+ClientBenchmarkContext::~ClientBenchmarkContext() {
+  cleanup();
+}
+
+void ClientBenchmarkContext::cleanup() {
+  m_softwareRenderer.reset();
+  m_jobSystem.reset();
+  m_audioManager.reset();
+  m_textRenderer.reset();
+  m_fontManager.reset();
+
+  if (m_renderer != nullptr) {
+    SDL_DestroyRenderer(m_renderer);
+    m_renderer = nullptr;
+  }
+
+  if (m_window != nullptr) {
+    SDL_DestroyWindow(m_window);
+    m_window = nullptr;
+  }
+
+  SDL_Quit();
+}
+
+SDL_Renderer *ClientBenchmarkContext::getRenderer() const {
+  return m_renderer;
+}
+
+TTF_Font *ClientBenchmarkContext::getFont() const {
+  return m_fontManager->getFontMd();
+}
+
+TextRenderer &ClientBenchmarkContext::getTextRenderer() const {
+  return *m_textRenderer;
+}
+
+AudioManager &ClientBenchmarkContext::getAudioManager() const {
+  return *m_audioManager;
+}
+
+SoftwareRenderer &ClientBenchmarkContext::getSoftwareRenderer() const {
+  return *m_softwareRenderer;
+}
+
+namespace Benchmarks {
+  std::vector<Benchmark::Case> getClientCases(ClientBenchmarkContext &context) {
+    std::vector<Benchmark::Case> cases;
+    addAudioCases(cases, context);
+    addTextCases(cases, context);
+    addRenderCases(cases, context);
+    return cases;
+  }
+} // namespace Benchmarks
@@ -0,0 +1,406 @@
+#include "../includes/Configuration/ConfigManager.hpp"
+#include "../includes/EntityManagement/EntityManager.hpp"
+#include "../includes/Helpers/BinaryIO.hpp"
+#include "../includes/Helpers/CollisionHelpers.hpp"
+#include "../includes/Helpers/EntityHelpers.hpp"
+#include "../includes/Helpers/ParticleSystem.hpp"
+#include "../includes/Helpers/RandomStream.hpp"
+#include "../includes/Helpers/SpawnHelpers.hpp"
+#include "../includes/Simulation/MainSceneSimulation.hpp"
+#include "./Benchmarks.hpp"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace {
+  constexpr std::uint32_t SEED = 1;
+
+  constexpr std::array<size_t, 3> ENTITY_COUNTS          = {100, 500, 2000};
+  constexpr std::array<size_t, 3> MANAGER_ENTITY_COUNTS  = {100, 1000, 10000};
+  constexpr std::array<double, 2> DENSITIES              = {0.05, 0.3};
+  constexpr size_t                EXPIRED_LIFESPAN_EVERY = 10;
+  constexpr size_t                CHURN_EVERY            = 10;
+  constexpr std::uint64_t         LIFESPAN               = 60 * 1000;
+  constexpr float                 QUERY_RADIUS           = 150;
+  constexpr size_t                QUERY_POSITION_COUNT   = 1024;
+  constexpr std::array<size_t, 3> PARTICLE_COUNTS        = {1000, 10000, 50000};
+  constexpr float                 PARTICLE_FRAME_TIME    = 1.0f / 60;
+
+  /**
+   * Which non-player entities a population is made of. Bullets are left out because they
+   * destroy what they hit, so a population containing them would not be stable.
+   */
+  enum class TagMix { ENEMIES, MIXED };
+
+  constexpr std::array<TagMix, 2> TAG_MIXES = {TagMix::ENEMIES, TagMix::MIXED};
+
+  struct Population {
+    size_t count;
+    double density;
+    TagMix tagMix;
+  };
+
+  std::string getTagMixName(const TagMix tagMix) {
+    return tagMix == TagMix::ENEMIES ? "enemies" : "mixed";
+  }
+
+  EntityTags getTag(const TagMix tagMix, const size_t index) {
+    constexpr std::array<EntityTags, 4> MIXED_TAGS = {
+        EntityTags::Enemy,
+        EntityTags::Item,
+        EntityTags::SpeedBoost,
+        EntityTags::SlownessDebuff,
+    };
+
+    if (tagMix == TagMix::ENEMIES) {
+      return EntityTags::Enemy;
+    }
+    return MIXED_TAGS[index % MIXED_TAGS.size()];
+  }
+
+  const ShapeConfig &getShapeConfig(const ConfigManager &configManager, const EntityTags tag) {
+    switch (tag) {
+      case EntityTags::Item:
+        return configManager.getItemConfig().shape;
+      case EntityTags::SpeedBoost:
+        return configManager.getSpeedEffectConfig().shape;
+      case EntityTags::SlownessDebuff:
+        return configManager.getSlownessEffectConfig().shape;
+      default:
+        return configManager.getEnemyConfig().shape;
+    }
+  }
+
+  nlohmann::json getParams(const Population &population) {
+    return {
+        {"entityCount", population.count},
+        {"density", population.density},
+        {"tagMix", getTagMixName(population.tagMix)},
+    };
+  }
+
+  std::vector<Population> getPopulations() {
+    std::vector<Population> populations;
+    for (const size_t count : ENTITY_COUNTS) {
+      for (const double density : DENSITIES) {
+        for (const TagMix tagMix : TAG_MIXES) {
+          populations.push_back({.count = count, .density = density, .tagMix = tagMix});
+        }
+      }
+    }
+    return populations;
+  }
+
+  /**
+   * A simulation holding the player, the walls and a population scattered over a window
+   * sized so that the population's shapes cover `density` of it. Every tenth lifespan is
+   * already over. Restoring the snapshot undoes whatever a system did to the fixture.
+   */
+  struct SimulationFixture {
+    std::unique_ptr<ConfigManager>       configManager;
+    std::unique_ptr<MainSceneSimulation> simulation;
+    std::vector<std::uint8_t>            snapshot;
+
+    void restore() const {
+      BinaryReader reader(snapshot);
+      simulation->restoreSnapshot(reader);
+    }
+  };
+
+  std::shared_ptr<SimulationFixture>
+  createSimulationFixture(const std::filesystem::path &configPath,
+                          const Population            &population) {
+    auto fixture           = std::make_shared<SimulationFixture>();
+    fixture->configManager = std::make_unique<ConfigManager>(configPath);
+    ConfigManager &config  = *fixture->configManager;
+
+    float coveredArea = 0;
+    for (size_t index = 0; index < population.count; index++) {
+      const ShapeConfig &shape = getShapeConfig(config, getTag(population.tagMix, index));
+      coveredArea += shape.width * shape.height;
+    }
+
+    const Vec2  &defaultSize = config.getGameConfig().windowSize;
+    const float  aspectRatio = defaultSize.x / defaultSize.y;
+    const auto   width       = static_cast<float>(
+        std::sqrt(coveredArea / population.density * aspectRatio));
+    config.updateGameWindowSize(Vec2(std::round(width), std::round(width / aspectRatio)));
+
+    fixture->simulation             = std::make_unique<MainSceneSimulation>(config, SEED);
+    MainSceneSimulation &simulation = *fixture->simulation;
+
+    // One tick moves the clock past the deadlines of the expired lifespans below.
+    simulation.update(MainSceneSimulation::TICK_DURATION);
+
+    EntityManager &entityManager = simulation.getEntityManager();
+    for (const std::shared_ptr<Entity> &entity : entityManager.getEntities()) {
+      if (entity->tag() != EntityTags::Player && entity->tag() != EntityTags::Wall) {
+        entity->destroy();
+      }
+    }
+    entityManager.update();
+
+    const Vec2                    &windowSize  = config.getGameConfig().windowSize;
+    const std::shared_ptr<Entity> &player      = simulation.getPlayer();
+    const std::uint64_t            currentTime = simulation.getCurrentTime();
+    RandomStream                   placement(SEED, 0, 0);
+
+    for (size_t index = 0; index < population.count; index++) {
+      const EntityTags               tag    = getTag(population.tagMix, index);
+      const ShapeConfig             &shape  = getShapeConfig(config, tag);
+      const std::shared_ptr<Entity> &entity = entityManager.addEntity(tag);
+
+      const bool expired    = index % EXPIRED_LIFESPAN_EVERY == 0;
+      const auto cLifespan  = expired ? std::make_shared<CLifespan>(0, 0)
+                                      : std::make_shared<CLifespan>(LIFESPAN, currentTime);
+      const Vec2 velocity   = SpawnHelpers::createValidVelocity(placement);
+      const auto cTransform = std::make_shared<CTransform>(Vec2(0, 0), velocity);
+
+      entity->setComponent<CShape>(std::make_shared<CShape>(shape));
+      entity->setComponent<CLifespan>(cLifespan);
+      entity->setComponent<CTransform>(cTransform);
+
+      // Keep clear of the player so the population survives its first collision pass.
+      const Vec2 placementArea(windowSize.x - shape.width, windowSize.y - shape.height);
+      do {
+        cTransform->topLeftCornerPos =
+            SpawnHelpers::createRandomPosition(placement, placementArea);
+      } while (CollisionHelpers::calculateCollisionBetweenEntities(entity, player));
+    }
+    entityManager.update();
+
+    BinaryWriter writer;
+    simulation.saveSnapshot(writer);
+    fixture->snapshot = writer.getBuffer();
+    return fixture;
+  }
+
+  std::vector<Vec2> createQueryPositions(const Vec2 &windowSize) {
+    RandomStream      random(SEED, 1, 0);
+    std::vector<Vec2> positions;
+    for (size_t index = 0; index < QUERY_POSITION_COUNT; index++) {
+      positions.push_back(SpawnHelpers::createRandomPosition(random, windowSize));
+    }
+    return positions;
+  }
+
+  void addEntityManagerCases(std::vector<Benchmark::Case> &cases) {
+    for (const size_t count : MANAGER_ENTITY_COUNTS) {
+      for (const TagMix tagMix : TAG_MIXES) {
+        const nlohmann::json params = {
+            {"entityCount", count},
+            {"tagMix", getTagMixName(tagMix)},
+        };
+
+        cases.push_back({
+            .name   = "EntityManager::addEntity",
+            .params = params,
+            .setup  = [count, tagMix]() -> Benchmark::Body {
+              auto entityManager = std::make_shared<EntityManager>();
+              return {
+                  .run =
+                      [entityManager, count, tagMix]() -> void {
+                        for (size_t index = 0; index < count; index++) {
+                          entityManager->addEntity(getTag(tagMix, index));
+                        }
+                        entityManager->update();
+                      },
+                  .reset = [entityManager]() -> void { entityManager->clear(); },
+              };
+            },
+        });
+
+        // Every iteration destroys and replaces a tenth of the entities before updating.
+        cases.push_back({
+            .name   = "EntityManager::update",
+            .params = params,
+            .setup  = [count, tagMix]() -> Benchmark::Body {
+              auto entityManager = std::make_shared<EntityManager>();
+              for (size_t index = 0; index < count; index++) {
+                entityManager->addEntity(getTag(tagMix, index));
+              }
+              entityManager->update();
+
+              return {
+                  .run   = [entityManager]() -> void { entityManager->update(); },
+                  .reset =
+                      [entityManager, tagMix]() -> void {
+                        const EntityVector &entities = entityManager->getEntities();
+                        for (size_t index = 0; index < entities.size(); index += CHURN_EVERY) {
+                          entities[index]->destroy();
+                          entityManager->addEntity(getTag(tagMix, index));
+                        }
+                      },
+              };
+            },
+        });
+      }
+    }
+  }
+
+  void addSystemCases(std::vector<Benchmark::Case> &cases,
+                      const std::filesystem::path  &configPath) {
+    for (const Population &population : getPopulations()) {
+      cases.push_back({
+          .name   = "MainSceneSimulation::sCollision",
+          .params = getParams(population),
+          .setup  = [configPath, population]() -> Benchmark::Body {
+            const auto fixture = createSimulationFixture(configPath, population);
+            return {
+                .run   = [fixture]() -> void { fixture->simulation->sCollision(); },
+                .reset = [fixture]() -> void { fixture->restore(); },
+            };
+          },
+      });
+
+      // Entities drift further every iteration, but the cost of moving them stays the same.
+      cases.push_back({
+          .name   = "MainSceneSimulation::sMovement",
+          .params = getParams(population),
+          .setup  = [configPath, population]() -> Benchmark::Body {
+            const auto fixture = createSimulationFixture(configPath, population);
+            return {.run = [fixture]() -> void { fixture->simulation->sMovement(); }};
+          },
+      });
+
+      cases.push_back({
+          .name   = "MainSceneSimulation::sLifespan",
+          .params = getParams(population),
+          .setup  = [configPath, population]() -> Benchmark::Body {
+            const auto fixture = createSimulationFixture(configPath, population);
+            return {
+                .run   = [fixture]() -> void { fixture->simulation->sLifespan(); },
+                .reset = [fixture]() -> void { fixture->restore(); },
+            };
+          },
+      });
+    }
+  }
+
+  void addHelperCases(std::vector<Benchmark::Case> &cases,
+                      const std::filesystem::path  &configPath) {
+    for (const Population &population : getPopulations()) {
+      // The spawner tries a different random position for every candidate.
+      cases.push_back({
+          .name   = "SpawnHelpers::validateSpawnPosition",
+          .params = getParams(population),
+          .setup  = [configPath, population]() -> Benchmark::Body {
+            const auto     fixture    = createSimulationFixture(configPath, population);
+            const Vec2    &windowSize = fixture->configManager->getGameConfig().windowSize;
+            EntityManager &entities   = fixture->simulation->getEntityManager();
+
+            // Pending entities are not collision candidates, so the candidate stays pending.
+            const auto candidate  = entities.addEntity(EntityTags::Enemy);
+            const auto cTransform = std::make_shared<CTransform>(Vec2(0, 0), Vec2(0, 0));
+            candidate->setComponent<CShape>(
+                std::make_shared<CShape>(fixture->configManager->getEnemyConfig().shape));
+            candidate->setComponent<CTransform>(cTransform);
+
+            const auto positions = std::make_shared<std::vector<Vec2>>(
+                createQueryPositions(windowSize));
+            const auto next = std::make_shared<size_t>(0);
+
+            return {.run = [fixture, candidate, cTransform, positions, next]() -> void {
+              cTransform->topLeftCornerPos = (*positions)[(*next)++ % positions->size()];
+              Benchmark::keep(SpawnHelpers::validateSpawnPosition(
+                  candidate,
+                  fixture->simulation->getPlayer(),
+                  fixture->simulation->getEntityManager(),
+                  fixture->configManager->getGameConfig().windowSize));
+            }};
+          },
+      });
+
+      cases.push_back({
+          .name   = "EntityHelpers::getEntitiesInRadius",
+          .params = getParams(population),
+          .setup  = [configPath, population]() -> Benchmark::Body {
+            const auto fixture = createSimulationFixture(configPath, population);
+            const auto next    = std::make_shared<size_t>(0);
+
+            return {.run = [fixture, next]() -> void {
+              const EntityVector &entities =
+                  fixture->simulation->getEntityManager().getEntities();
+              const std::shared_ptr<Entity> &entity = entities[(*next)++ % entities.size()];
+              Benchmark::keep(static_cast<double>(
+                  EntityHelpers::getEntitiesInRadius(entity, entities, QUERY_RADIUS).size()));
+            }};
+          },
+      });
+    }
+
+    cases.push_back({
+        .name   = "CollisionHelpers::calculateOverlap",
+        .params = nlohmann::json::object(),
+        .setup  = [configPath]() -> Benchmark::Body {
+          const ConfigManager configManager(configPath);
+          const ShapeConfig  &shape = configManager.getEnemyConfig().shape;
+          const Vec2          offset(shape.width / 2, shape.height / 2);
+
+          auto       entityManager = std::make_shared<EntityManager>();
+          const auto entityA       = entityManager->addEntity(EntityTags::Enemy);
+          const auto entityB       = entityManager->addEntity(EntityTags::Enemy);
+          entityA->setComponent<CShape>(std::make_shared<CShape>(shape));
+          entityB->setComponent<CShape>(std::make_shared<CShape>(shape));
+          entityA->setComponent<CTransform>(
+              std::make_shared<CTransform>(Vec2(0, 0), Vec2(0, 0)));
+          entityB->setComponent<CTransform>(std::make_shared<CTransform>(offset, Vec2(0, 0)));
+          entityManager->update();
+
+          return {.run = [entityManager, entityA, entityB]() -> void {
+            Benchmark::keep(CollisionHelpers::calculateOverlap(entityA, entityB).x);
+          }};
+        },
+    });
+  }
+
+  void addParticleCases(std::vector<Benchmark::Case> &cases) {
+    for (const size_t count : PARTICLE_COUNTS) {
+      // A frame of a busy scene: the particles move and age, and bursts like a hit's
+      // replace the ones that died, so the population holds steady.
+      cases.push_back({
+          .name   = "ParticleSystem::update",
+          .params = {{"particles", count}},
+          .setup  = [count]() -> Benchmark::Body {
+            const auto particles = std::make_shared<ParticleSystem>(count);
+            const auto refill    = [particles]() -> void {
+              ParticleSystem::Burst burst = {
+                  .position    = {0, 0},
+                  .count       = 64,
+                  .color       = {.r = 255, .g = 170, .b = 60, .a = 255},
+                  .minSpeed    = 60,
+                  .maxSpeed    = 240,
+                  .minLifetime = 0.5f,
+                  .maxLifetime = 1.5f,
+                  .size        = 4,
+              };
+              while (particles->getCount() < particles->getCapacity()) {
+                particles->emit(burst);
+                burst.position += Vec2(7, 3);
+              }
+            };
+            refill();
+
+            return {.run = [particles, refill]() -> void {
+              particles->update(PARTICLE_FRAME_TIME);
+              refill();
+              Benchmark::keep(particles->getPositionX()[0]);
+            }};
+          },
+      });
+    }
+  }
+} // namespace
+
+namespace Benchmarks {
+  std::vector<Benchmark::Case> getCoreCases(const std::filesystem::path &configPath) {
+    std::vector<Benchmark::Case> cases;
+    addEntityManagerCases(cases);
+    addSystemCases(cases, configPath);
+    addHelperCases(cases, configPath);
+    addParticleCases(cases);
+    return cases;
+  }
+} // namespace Benchmarks
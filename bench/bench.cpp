@@ -0,0 +1,117 @@
+#include "../includes/Configuration/ConfigManager.hpp"
+#include "../includes/Helpers/LogHelpers.hpp"
+#include "./Benchmarks.hpp"
+#include "./ClientBenchmarkContext.hpp"
+
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/*
+ * Runs the microbenchmarks of the simulation core and the SDL client code on SDL's dummy
+ * drivers and writes the results as JSON. Each benchmark runs once per combination of its
+ * parameters (entity count, density, tag mix and the like) and reports the median, mean and
+ * minimum time per iteration. With --baseline, medians are compared against earlier results
+ * and the exit status is 1 if any is slower by more than --threshold percent (default 10).
+ *
+ * Usage: yerb_bench [--filter <text>] [--output <file>] [--baseline <file>]
+ *                   [--threshold <percent>] [--config <file>]
+ */
+int main(const int argc, char *argv[]) {
+  constexpr double DEFAULT_THRESHOLD = 10;
+
+  std::optional<std::string>           filter;
+  std::optional<std::filesystem::path> outputPath;
+  std::optional<std::filesystem::path> baselinePath;
+  double                               threshold  = DEFAULT_THRESHOLD;
+  std::filesystem::path                configPath = "config/config.json";
+
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    const bool        hasValue = i + 1 < argc;
+    if (argument == "--filter" && hasValue) {
+      filter = argv[++i];
+    } else if (argument == "--output" && hasValue) {
+      outputPath = argv[++i];
+    } else if (argument == "--baseline" && hasValue) {
+      baselinePath = argv[++i];
+    } else if (argument == "--threshold" && hasValue) {
+      threshold = std::stod(argv[++i]);
+    } else if (argument == "--config" && hasValue) {
+      configPath = argv[++i];
+    } else {
+      std::fprintf(stderr,
+                   "Usage: %s [--filter <text>] [--output <file>] [--baseline <file>] "
+                   "[--threshold <percent>] [--config <file>]\n",
+                   argv[0]);
+      return 2;
+    }
+  }
+
+  // Spawning logs are noise at benchmark speed.
+  LogHelpers::setLogSink([](const LogHelpers::LogLevel level, const std::string &message) {
+    if (level == LogHelpers::LogLevel::ERROR) {
+      std::fprintf(stderr, "%s\n", message.c_str());
+    }
+  });
+  SDL_LogSetAllPriority(SDL_LOG_PRIORITY_ERROR);
+
+  try {
+    const ConfigManager    configManager(configPath);
+    ClientBenchmarkContext context(configManager.getGameConfig());
+
+    std::vector<Benchmark::Case> cases = Benchmarks::getCoreCases(configPath);
+    for (Benchmark::Case &clientCase : Benchmarks::getClientCases(context)) {
+      cases.push_back(std::move(clientCase));
+    }
+
+    std::vector<Benchmark::Result> results;
+    for (const Benchmark::Case &benchmarkCase : cases) {
+      if (filter.has_value() && benchmarkCase.name.find(*filter) == std::string::npos) {
+        continue;
+      }
+
+      results.push_back(Benchmark::runCase(benchmarkCase));
+      const Benchmark::Result &result = results.back();
+      std::fprintf(stderr,
+                   "%-40s %-48s %12.1f ns\n",
+                   result.name.c_str(),
+                   result.params.dump().c_str(),
+                   result.medianNs);
+    }
+
+    const std::string json = Benchmark::toJson(results).dump(2);
+    if (outputPath.has_value()) {
+      std::ofstream file(*outputPath);
+      file << json << '\n';
+      if (!file) {
+        throw std::runtime_error("Could not write " + outputPath->string());
+      }
+    } else {
+      std::printf("%s\n", json.c_str());
+    }
+
+    if (!baselinePath.has_value()) {
+      return 0;
+    }
+
+    const std::vector<Benchmark::Result> baseline = Benchmark::loadResults(*baselinePath);
+
+    const size_t regressions = Benchmark::compare(results, baseline, threshold);
+    if (regressions > 0) {
+      std::fprintf(stderr,
+                   "%zu benchmarks are more than %.1f%% slower than the baseline\n",
+                   regressions,
+                   threshold);
+      return 1;
+    }
+    return 0;
+  } catch (const std::exception &error) {
+    std::fprintf(stderr, "%s\n", error.what());
+    return 1;
+  }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../SystemManagement/SoftwareRenderer.hpp"
+#include "TextureAtlas.hpp"
+#include <SDL2/SDL.h>
+#include <SDL_ttf.h>
+#include <array>
+#include <vector>
+
+/**
+ * The printable ASCII glyphs of a font, rendered once into a single TextureAtlas page.
+ *
+ * Glyphs are rendered in white, so text of any colour can be drawn from the atlas by
+ * modulating it with a vertex colour. Each glyph's advance and the kerning between every
+ * pair of glyphs are cached alongside, so laying out a line makes no calls into SDL_ttf.
+ */
+class GlyphAtlas {
+public:
+  static constexpr char FIRST_GLYPH = ' ';
+  static constexpr char LAST_GLYPH  = '~';
+
+  static constexpr size_t GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+
+  /**
+   * A glyph's box as SDL_ttf renders it at the pen position, and how far it moves the pen,
+   * in pixels, with where the box lies in the atlas.
+   */
+  struct Glyph {
+    int       width   = 0;
+    int       height  = 0;
+    int       advance = 0;
+    SDL_FRect texCoords{};
+    bool      provided = false;
+  };
+
+private:
+  TextureAtlas                   m_atlas;
+  std::array<Glyph, GLYPH_COUNT> m_glyphs;
+  std::vector<int>               m_kerning;
+
+  static size_t getGlyphIndex(char character);
+
+public:
+  /**
+   * @param softwareRenderer The software render backend to register the atlas with, if it
+   * is in use.
+   * @throws std::runtime_error if the glyphs cannot be rendered or uploaded, or do not fit on
+   * one page.
+   */
+  GlyphAtlas(SDL_Renderer *renderer, TTF_Font *font, SoftwareRenderer *softwareRenderer);
+
+  GlyphAtlas(const GlyphAtlas &)            = delete;
+  GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+  SDL_Texture *getTexture() const;
+
+  /**
+   * The character's glyph, or nullptr if it is outside the atlas or the font lacks it.
+   */
+  const Glyph *getGlyph(char character) const;
+
+  /**
+   * The adjustment to the pen position between two characters, in pixels. Zero when either
+   * is outside the atlas.
+   */
+  int getKerning(char previous, char next) const;
+};
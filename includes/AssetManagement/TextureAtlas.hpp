@@ -0,0 +1,60 @@
+#pragma once
+
+#include "../SystemManagement/SoftwareRenderer.hpp"
+#include <SDL2/SDL.h>
+#include <optional>
+#include <vector>
+
+/**
+ * Images packed into as few atlas textures, or pages, as the renderer's maximum texture size
+ * allows, so they can be drawn in the same batch. Backs both the TextureManager's sprites and
+ * the GlyphAtlas's glyphs.
+ */
+class TextureAtlas {
+public:
+  /**
+   * Where an image lies in the atlas: the page it was packed into, and its rect there in
+   * normalized texture coordinates.
+   */
+  struct Region {
+    size_t    pageIndex = 0;
+    SDL_FRect texCoords{};
+  };
+
+private:
+  std::vector<SDL_Texture *>         m_pages   = {};
+  std::vector<std::optional<Region>> m_regions = {};
+
+  void destroyPages();
+
+public:
+  TextureAtlas() = default;
+
+  /**
+   * Packs and uploads the images. The surfaces stay owned by the caller, which can free them
+   * once this returns. Null entries are skipped and get no region.
+   *
+   * @param softwareRenderer The software render backend to register the pages with, if it is
+   * in use.
+   * @throws std::runtime_error if a page cannot be created or uploaded.
+   */
+  TextureAtlas(SDL_Renderer                     *renderer,
+               SoftwareRenderer                 *softwareRenderer,
+               const std::vector<SDL_Surface *> &images);
+  ~TextureAtlas();
+
+  TextureAtlas(const TextureAtlas &)            = delete;
+  TextureAtlas &operator=(const TextureAtlas &) = delete;
+  TextureAtlas(TextureAtlas &&other) noexcept;
+  TextureAtlas &operator=(TextureAtlas &&other) noexcept;
+
+  /**
+   * The region of the image at the same index in the constructor's list, or nullptr if that
+   * entry was null.
+   */
+  const Region *getRegion(size_t imageIndex) const;
+
+  SDL_Texture *getPage(size_t pageIndex) const;
+
+  size_t getPageCount() const;
+};
@@ -1,22 +1,60 @@
 #pragma once
+#include "../EntityManagement/Components.hpp"
+#include "../SystemManagement/SoftwareRenderer.hpp"
+#include "TextureAtlas.hpp"
 #include <SDL2/SDL.h>
 #include <filesystem>
 #include <unordered_map>
+#include <vector>
 
-enum class TextureName { DEFAULT, EXAMPLE };
 const std::unordered_map<TextureName, std::filesystem::path> imagePaths = {
     {TextureName::EXAMPLE, "assets/images/example.png"}};
 
+/**
+ * Where a sprite lies in the TextureManager's atlases: the atlas texture it was packed into,
+ * and its rect there in normalized texture coordinates.
+ */
+struct SpriteRegion {
+  size_t    textureIndex = 0;
+  SDL_FRect texCoords{};
+};
+
+/**
+ * Loads every image in `imagePaths` at startup and packs them into a TextureAtlas, so sprites
+ * of different kinds can be drawn in the same batch. The decoded images are freed once the
+ * atlas is uploaded.
+ */
 class TextureManager {
-  std::unordered_map<TextureName, SDL_Surface *> m_surfaces = {};
-  std::unordered_map<TextureName, SDL_Texture *> m_textures = {};
-  SDL_Renderer                                  *m_renderer;
+  TextureAtlas                                  m_atlas;
+  std::unordered_map<TextureName, SpriteRegion> m_regions = {};
+  SDL_Renderer                                 *m_renderer;
+  SoftwareRenderer                             *m_softwareRenderer;
 
-  void loadTexture(TextureName name);
+  /**
+   * Packs the loaded images into the atlas and records each image's region. Takes ownership
+   * of the surfaces and frees them.
+   */
+  void buildAtlases(std::vector<std::pair<TextureName, SDL_Surface *>> &images);
 
 public:
-  explicit TextureManager(SDL_Renderer *renderer);
+  /**
+   * @param softwareRenderer The software render backend to register the atlases with, if it
+   * is in use.
+   */
+  TextureManager(SDL_Renderer *renderer, SoftwareRenderer *softwareRenderer);
   ~TextureManager();
 
-  SDL_Texture *getTexture(TextureName name);
+  TextureManager(const TextureManager &)            = delete;
+  TextureManager &operator=(const TextureManager &) = delete;
+
+  /**
+   * The region the texture was packed into, or nullptr if its image could not be loaded or
+   * uploaded.
+   */
+  const SpriteRegion *getSpriteRegion(TextureName name) const;
+
+  /**
+   * The atlas texture at a region's `textureIndex`.
+   */
+  SDL_Texture *getTexture(size_t textureIndex) const;
 };
@@ -1,17 +1,19 @@
 #pragma once
 
+#include "../Helpers/Color.hpp"
 #include "../Helpers/Vec2.hpp"
-#include <SDL2/SDL.h>
+#include <cstdint>
 #include <filesystem>
+#include <vector>
 
 class ShapeConfig {
 public:
-  float     height = 0;
-  float     width  = 0;
-  SDL_Color color  = {.r = 0, .g = 0, .b = 0, .a = 0};
+  float height = 0;
+  float width  = 0;
+  Color color  = {.r = 0, .g = 0, .b = 0, .a = 0};
 
   ShapeConfig() = default;
-  ShapeConfig(const float height, const float width, const SDL_Color color) :
+  ShapeConfig(const float height, const float width, const Color color) :
       height(height), width(width), color(color) {}
 };
 
@@ -19,7 +21,7 @@ struct GameConfig {
   Vec2                  windowSize;
   std::string           windowTitle;
   std::filesystem::path fontPath;
-  Uint64                spawnInterval = 0;
+  std::uint64_t         spawnInterval = 0;
 };
 
 struct PlayerConfig {
@@ -30,35 +32,100 @@ struct PlayerConfig {
 };
 
 struct ItemConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  std::uint8_t  spawnPercentage = 0;
+  std::uint64_t lifespan        = 0;
+  float         speed           = 0;
+  ShapeConfig   shape;
 };
 
 struct EnemyConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  std::uint8_t  spawnPercentage = 0;
+  std::uint64_t lifespan        = 0;
+  float         speed           = 0;
+  ShapeConfig   shape;
 };
 
 struct SpeedEffectConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  std::uint8_t  spawnPercentage = 0;
+  std::uint64_t lifespan        = 0;
+  float         speed           = 0;
+  ShapeConfig   shape;
 };
 
 struct SlownessEffectConfig {
-  Uint8       spawnPercentage = 0;
-  Uint64      lifespan        = 0;
-  float       speed           = 0;
-  ShapeConfig shape;
+  std::uint8_t  spawnPercentage = 0;
+  std::uint64_t lifespan        = 0;
+  float         speed           = 0;
+  ShapeConfig   shape;
 };
 
 struct BulletConfig {
-  Uint64      lifespan = 0;
-  float       speed    = 0;
-  ShapeConfig shape;
-};
\ No newline at end of file
+  std::uint64_t lifespan = 0;
+  float         speed    = 0;
+  ShapeConfig   shape;
+};
+
+struct RewindConfig {
+  size_t        memoryBudget     = 0;
+  std::uint64_t keyframeInterval = 0;
+};
+
+struct SpawnBudgetConfig {
+  bool         enabled              = false;
+  float        frameTimeTarget      = 0;
+  bool         cullingEnabled       = false;
+  std::uint8_t maxCullPerAdjustment = 0;
+};
+
+struct FrameStatsConfig {
+  float frameTimeTarget = 0;
+};
+
+/**
+ * How the native main loop paces frames: `VSYNC` waits for the display when presenting,
+ * `CAP` sleeps to hold `frameRateCap`, and `UNCAPPED` runs as fast as it can, for
+ * benchmarking.
+ */
+enum class FramePacingMode { VSYNC, CAP, UNCAPPED };
+
+struct FramePacingConfig {
+  FramePacingMode mode          = FramePacingMode::VSYNC;
+  float           frameRateCap  = 0;
+  float           spinThreshold = 0;
+};
+
+/**
+ * What draws the frames: `SDL` hands batched geometry to the SDL renderer, and `SOFTWARE`
+ * rasterizes it in the engine and only presents the finished frame through SDL, for hosts
+ * without a GPU.
+ */
+enum class RenderBackend { SDL, SOFTWARE };
+
+struct RenderConfig {
+  RenderBackend backend = RenderBackend::SDL;
+};
+
+/**
+ * How many of each kind of non-player entity a stress test keeps alive.
+ */
+struct StressPopulation {
+  size_t enemies         = 0;
+  size_t bullets         = 0;
+  size_t items           = 0;
+  size_t speedBoosts     = 0;
+  size_t slownessDebuffs = 0;
+};
+
+/**
+ * A stress test stage ramps linearly from the previous stage's population to its own over
+ * `rampFrames`, then holds it for `holdFrames`, which are the frames it is measured over.
+ */
+struct StressStageConfig {
+  StressPopulation population;
+  std::uint64_t    rampFrames = 0;
+  std::uint64_t    holdFrames = 0;
+};
+
+struct StressConfig {
+  std::vector<StressStageConfig> stages;
+};
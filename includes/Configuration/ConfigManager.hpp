@@ -23,6 +23,12 @@ private:
   ItemConfig            m_itemConfig;
   SpeedEffectConfig     m_speedEffectConfig;
   SlownessEffectConfig  m_slownessEffectConfig;
+  RewindConfig          m_rewindConfig;
+  SpawnBudgetConfig     m_spawnBudgetConfig;
+  FrameStatsConfig      m_frameStatsConfig;
+  FramePacingConfig     m_framePacingConfig;
+  RenderConfig          m_renderConfig;
+  StressConfig          m_stressConfig;
   json                  m_json;
   std::filesystem::path m_configPath;
 
@@ -30,7 +36,7 @@ private:
   static JsonReturnType
   getJsonValue(const json &jsonValue, const std::string &key, const std::string &context);
 
-  static SDL_Color   parseColor(const json &colorJson, const std::string &context);
+  static Color       parseColor(const json &colorJson, const std::string &context);
   static ShapeConfig parseShapeConfig(const json &shapeJson, const std::string &context);
   void               parseGameConfig();
   void               parseItemConfig();
@@ -39,6 +45,12 @@ private:
   void               parseSpeedEffectConfig();
   void               parseSlownessEffectConfig();
   void               parseBulletConfig();
+  void               parseRewindConfig();
+  void               parseSpawnBudgetConfig();
+  void               parseFrameStatsConfig();
+  void               parseFramePacingConfig();
+  void               parseRenderConfig();
+  void               parseStressConfig();
   void               parseConfig();
   void               loadConfig();
 
@@ -52,6 +64,12 @@ public:
   const BulletConfig         &getBulletConfig() const;
   const SpeedEffectConfig    &getSpeedEffectConfig() const;
   const SlownessEffectConfig &getSlownessEffectConfig() const;
+  const RewindConfig         &getRewindConfig() const;
+  const SpawnBudgetConfig    &getSpawnBudgetConfig() const;
+  const FrameStatsConfig     &getFrameStatsConfig() const;
+  const FramePacingConfig    &getFramePacingConfig() const;
+  const RenderConfig         &getRenderConfig() const;
+  const StressConfig         &getStressConfig() const;
 
   void updatePlayerShape(const ShapeConfig &shape);
   void updatePlayerSpeed(float speed);
@@ -1,9 +1,12 @@
 #pragma once
 
-#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 #include "../Configuration/Config.hpp"
+#include "../Helpers/Color.hpp"
+#include "../Helpers/Rect.hpp"
 #include "../Helpers/Vec2.hpp"
 
 class CTransform {
@@ -18,27 +21,14 @@ public:
 };
 
 class CShape {
-  SDL_Renderer *renderer;
-
 public:
-  SDL_Rect  rect;
-  SDL_Color color;
-
-  CShape(SDL_Renderer *renderer, const ShapeConfig &config) :
-      renderer(renderer), rect(), color() {
-
-    if (renderer == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "CShape entity initialization failed: Renderer is null.");
-      throw std::runtime_error("CShape entity initialization failed: Renderer is null.");
-    }
+  Rect  rect;
+  Color color;
 
+  explicit CShape(const ShapeConfig &config) :
+      rect(), color(config.color) {
     rect.h = static_cast<int>(config.height);
     rect.w = static_cast<int>(config.width);
-    color  = config.color;
-
-    SDL_SetRenderDrawColor(renderer, config.color.r, config.color.g, config.color.b, 255);
-    SDL_RenderFillRect(renderer, &rect);
   }
 };
 
@@ -54,21 +44,33 @@ public:
 
 class CLifespan {
 public:
-  Uint64 birthTime;
-  Uint64 lifespan = 0;
+  std::uint64_t birthTime = 0;
+  std::uint64_t lifespan  = 0;
 
-  CLifespan() :
-      birthTime(SDL_GetTicks64()) {}
-  explicit CLifespan(const Uint64 lifespan) :
-      birthTime(SDL_GetTicks64()), lifespan(lifespan) {}
+  CLifespan() = default;
+  CLifespan(const std::uint64_t lifespan, const std::uint64_t birthTime) :
+      birthTime(birthTime), lifespan(lifespan) {}
+
+  /**
+   * The opacity of an entity that fades out over its lifespan, from 255 at birth to 0.
+   */
+  std::uint8_t getFadeAlpha(const std::uint64_t currentTime) const {
+    constexpr float MAX_COLOR_VALUE = 255.0f;
+
+    const std::uint64_t elapsedTime = currentTime - birthTime;
+    const float         lifespanPercentage =
+        std::min(1.0f, static_cast<float>(elapsedTime) / static_cast<float>(lifespan));
+
+    return static_cast<std::uint8_t>(MAX_COLOR_VALUE * (1.0f - lifespanPercentage));
+  }
 };
 
 enum EffectTypes { Speed, Slowness };
 
 struct Effect {
-  Uint64      startTime;
-  Uint64      duration;
-  EffectTypes type;
+  std::uint64_t startTime;
+  std::uint64_t duration;
+  EffectTypes   type;
 };
 
 class CEffects {
@@ -112,6 +114,8 @@ class CBounceTracker {
 
 public:
   CBounceTracker() = default;
+  explicit CBounceTracker(const int bounces) :
+      m_bounces(bounces) {}
 
   void addBounce() {
     m_bounces++;
@@ -122,14 +126,20 @@ public:
   }
 };
 
+/**
+ * Names of the textures a sprite can refer to. The simulation only stores the name; the
+ * front-end's TextureManager resolves it to the loaded texture when rendering.
+ */
+enum class TextureName { DEFAULT, EXAMPLE };
+
 class CSprite {
-  SDL_Texture *m_texture;
+  TextureName m_textureName;
 
 public:
-  explicit CSprite(SDL_Texture *texture) :
-      m_texture(texture) {}
+  explicit CSprite(const TextureName textureName) :
+      m_textureName(textureName) {}
 
-  SDL_Texture *getTexture() const {
-    return m_texture;
+  TextureName getTextureName() const {
+    return m_textureName;
   }
 };
\ No newline at end of file
@@ -21,6 +21,29 @@ public:
   EntityManager();
   std::shared_ptr<Entity> addEntity(const EntityTags tag);
   EntityVector           &getEntities();
+  const EntityVector     &getEntities() const;
   EntityVector           &getEntities(const EntityTags tag);
+  const EntityVector     &getPendingEntities() const;
+  size_t                  getTotalEntities() const;
   void                    update();
+
+  /**
+   * Removes every entity and restarts id assignment at `totalEntities`.
+   */
+  void clear(size_t totalEntities = 0);
+
+  /**
+   * Destroys every entity with an id of `totalEntities` or more, pending ones included, and
+   * restarts id assignment at `totalEntities`. Unlike `clear`, the vectors keep their
+   * storage, so refilling the manager does not allocate.
+   *
+   * @returns Whether every entity with a lower id was still alive, and so was kept.
+   */
+  bool truncate(size_t totalEntities);
+
+  /**
+   * Recreates an entity with a known id, e.g. when restoring a snapshot. Pending entities are
+   * queued for the next `update` like newly added ones; others are added immediately.
+   */
+  std::shared_ptr<Entity> restoreEntity(size_t id, EntityTags tag, bool pending);
 };
@@ -4,8 +4,13 @@
 #include "../AssetManagement/FontManager.hpp"
 #include "../AssetManagement/TextureManager.hpp"
 #include "../Configuration/ConfigManager.hpp"
+#include "../Helpers/FramePacer.hpp"
+#include "../Helpers/FrameTimeLog.hpp"
 #include "../SystemManagement/AudioManager.hpp"
+#include "../SystemManagement/TextRenderer.hpp"
 #include "../SystemManagement/VideoManager.hpp"
+#include "./JobSystem.hpp"
+#include "./LaunchOptions.hpp"
 
 #include <SDL2/SDL.h>
 #include <filesystem>
@@ -26,6 +31,12 @@ protected:
   std::unique_ptr<TextureManager>               m_texture_manager;
   std::unique_ptr<AudioSampleQueue>             m_audioSampleQueue;
   std::unique_ptr<VideoManager>                 m_videoManager;
+  std::unique_ptr<TextRenderer>                 m_textRenderer;
+  std::unique_ptr<JobSystem>                    m_jobSystem;
+  std::unique_ptr<FrameTimeLog>                 m_frameTimeLog;
+  std::unique_ptr<FramePacer>                   m_framePacer;
+  Uint64                                        m_lastFrameStart = 0;
+  LaunchOptions                                 m_launchOptions;
 
   /**
    * Calls the active scene's update method.
@@ -72,12 +83,12 @@ protected:
   /**
    * Create the TextureManager object.
    *
-   * The TextureManager is responsible the allocated memory for textures and surfaces..
+   * The TextureManager is responsible the allocated memory for textures..
    *
-   * When the TextureManager is created, it loads all surfaces from the assets folder and
-   * stores them in memory and generates textures from the surfaces.
+   * When the TextureManager is created, it loads all images from the assets folder, packs
+   * them into atlas textures and frees the decoded images.
    *
-   * When it goes out of scope, the textures and surfaces are automatically deleted.
+   * When it goes out of scope, the textures are automatically deleted.
    *
    * @returns std::unique_ptr<TextureManager> The initialized TextureManager object.
    */
@@ -87,16 +98,28 @@ protected:
    * Create a VideoManager object.
    *
    * The video manager is responsible for managing the SDL window and renderer. It uses the
-   * ConfigManager object to get the window size and other related configurations.
+   * ConfigManager object to get the window size and other related configurations, and the
+   * JobSystem for the software render backend.
    *
    * When the video manager is created, the window and renderer are created and initialized.
    * When it goes out of scope, the window and renderer are destroyed.
    *
-   * @throws std::runtime_error if ConfigManager is not initialized
+   * @throws std::runtime_error if ConfigManager or JobSystem is not initialized
    * @returns std::unique_ptr<VideoManager> The VideoManager object initialized
    */
   std::unique_ptr<VideoManager> createVideoManager() const;
 
+  /**
+   * Create the TextRenderer object, which builds a glyph atlas for every font of the
+   * FontManager on the VideoManager's renderer. Used by the rendering system in `Scene`
+   * objects to draw text.
+   *
+   * @throws std::runtime_error if VideoManager or FontManager is not initialized, or if a
+   * glyph atlas cannot be built
+   * @returns The TextRenderer object initialized
+   */
+  std::unique_ptr<TextRenderer> createTextRenderer() const;
+
   /**
    * Create an AudioManager object.
    *
@@ -130,14 +153,58 @@ protected:
    */
   std::unique_ptr<AudioSampleQueue> initializeAudioSampleQueue() const;
 
+  /**
+   * Create the JobSystem object, with one thread per hardware thread.
+   *
+   * Scenes use it to spread per-entity work across cores. In Emscripten builds without
+   * pthreads it has no workers and runs every job inline.
+   *
+   * @returns The JobSystem object initialized
+   */
+  static std::unique_ptr<JobSystem> createJobSystem();
+
+  /**
+   * Create the FrameTimeLog object, which counts hitches against the configured frame time
+   * target.
+   *
+   * @throws std::runtime_error if ConfigManager is not initialized
+   * @returns The FrameTimeLog object initialized
+   */
+  std::unique_ptr<FrameTimeLog> createFrameTimeLog() const;
+
+  /**
+   * Create the FramePacer object for the configured pacing mode. Vsync falls back to a cap
+   * at the display's refresh rate when the renderer could not enable it, and vsync targets
+   * the configured frame rate cap when the display does not report its refresh rate.
+   *
+   * @throws std::runtime_error if ConfigManager or VideoManager is not initialized
+   * @returns The FramePacer object initialized
+   */
+  std::unique_ptr<FramePacer> createFramePacer() const;
+
+  /**
+   * Records the duration of the frame that just ended, from its start to the start of the
+   * frame beginning now, against the active scene.
+   */
+  void recordFrameTime();
+
+  /**
+   * Logs a summary of every scene's frame times and writes them to the file requested with
+   * `--frame-stats`, if any.
+   */
+  void saveFrameTimes() const;
+
 public:
   /**
    * Constructs the GameEngine object and initializes all necessary managers and
    * resources.
    *
+   * Starts in the menu scene, or in the main scene when a replay was requested.
+   *
+   * @param launchOptions The options the game was started with.
    * @throws std::runtime_error if the assets directory is not found.
    */
-  GameEngine();
+  explicit GameEngine(LaunchOptions launchOptions = {});
 
   /**
    * Destroys the GameEngine object and cleans up all resources.
@@ -156,11 +223,21 @@ public:
   /**
    * Loads a scene into the game engine.
    *
+   * Marks a scene boundary in the frame time log: the scene's statistics start afresh, and
+   * the frame loading it is recorded as its transition frame.
+   *
    * @param sceneName The name of the scene to load
    * @param scene A shared pointer to the scene object to load
    */
   void loadScene(const std::string &sceneName, const std::shared_ptr<Scene> &scene);
 
+  /**
+   * Retrieves the frame time statistics of every scene loaded so far.
+   *
+   * @returns A reference to the frame time log.
+   */
+  const FrameTimeLog &getFrameTimeLog() const;
+
   /**
    * Retrieves the ConfigManager instance associated with the game engine.
    *
@@ -209,6 +286,35 @@ public:
    */
   TextureManager &getTextureManager() const;
 
+  /**
+   * Retrieves the TextRenderer instance associated with the game engine.
+   *
+   * @throws std::runtime_error if TextRenderer is not initialized.
+   * @returns A reference to the initialized TextRenderer object.
+   */
+  TextRenderer &getTextRenderer() const;
+
+  /**
+   * Retrieves the JobSystem instance associated with the game engine.
+   *
+   * @throws std::runtime_error if JobSystem is not initialized.
+   * @returns A reference to the initialized JobSystem object.
+   */
+  JobSystem &getJobSystem() const;
+
+  /**
+   * Retrieves the options the game engine was started with.
+   *
+   * @returns A reference to the launch options.
+   */
+  const LaunchOptions &getLaunchOptions() const;
+
+  /**
+   * Converts a span of SDL_GetPerformanceCounter() ticks to microseconds, the unit frame and
+   * system times are measured in.
+   */
+  static std::uint32_t toMicroseconds(Uint64 performanceCounterTicks);
+
   /**
    * This is the game engine's run method that is called by the C++ main function.
    *
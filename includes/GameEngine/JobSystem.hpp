@@ -0,0 +1,197 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A work-stealing thread pool for running per-frame work across cores.
+ *
+ * Every worker, and the thread that created the job system, has its own queue of ready jobs.
+ * A thread pushes the jobs it schedules onto its own queue and takes them back newest first,
+ * keeping related work on one core; a thread whose queue is empty steals the oldest job from
+ * another queue. Threads waiting on a job run other jobs in the meantime.
+ *
+ * Jobs may depend on other jobs and only become ready once all of them have finished. Jobs
+ * submitted to the main thread lane, e.g. anything that calls into SDL, only ever run on the
+ * creating thread: when it waits on a job or calls `runMainThreadJobs`.
+ *
+ * With one thread, or in Emscripten builds without pthreads, there are no workers and every
+ * job runs inline as soon as it is ready, so callers need no separate single-threaded path.
+ */
+class JobSystem {
+  struct Job {
+    std::function<void()>             function;
+    bool                              mainThreadOnly = false;
+    bool                              reusable       = false;
+    std::atomic<size_t>               pendingDependencies{1};
+    std::atomic<bool>                 finished{false};
+    std::mutex                        mutex;
+    std::vector<std::shared_ptr<Job>> dependents;
+  };
+
+  /**
+   * A ring buffer of jobs. It only grows, so once it has held a frame's worth of jobs,
+   * queueing more does not allocate.
+   */
+  struct JobQueue {
+    std::mutex                        mutex;
+    std::vector<std::shared_ptr<Job>> slots;
+    size_t                            first = 0;
+    size_t                            count = 0;
+
+    void push(std::shared_ptr<Job> job);
+
+    /**
+     * Take the most and the least recently queued job, or nullptr if the queue is empty.
+     */
+    std::shared_ptr<Job> takeNewest();
+    std::shared_ptr<Job> takeOldest();
+  };
+
+public:
+  /**
+   * Refers to a submitted job, to wait on it or to make other jobs depend on it. A default
+   * constructed handle refers to no job and counts as finished.
+   */
+  class JobHandle {
+    std::shared_ptr<Job> m_job;
+
+    friend class JobSystem;
+
+  public:
+    JobHandle() = default;
+
+    bool isFinished() const;
+  };
+
+  /**
+   * The threads jobs may run on.
+   */
+  enum class Lane { ANY_THREAD, MAIN_THREAD };
+
+  /**
+   * A parallel for over a fixed loop body that runs again and again without allocating, for
+   * loops run every step, e.g. stepping a batch of environments.
+   *
+   * Its helper jobs are created once and queued again on every run; a helper still queued
+   * or running from an earlier run takes part in the current one instead. Chunks are claimed
+   * with a counter tagged with the run it belongs to, so a late helper never claims a chunk
+   * of a run it did not see start. Runs must not overlap, and the loop must be destroyed
+   * before its job system.
+   */
+  class ParallelLoop {
+    JobSystem                                &m_jobSystem;
+    std::function<void(size_t, size_t)>       m_function;
+    std::vector<std::shared_ptr<Job>>         m_helpers;
+    std::atomic<std::uint64_t>                m_claims{0};
+    std::atomic<size_t>                       m_finishedChunks{0};
+    std::uint32_t                             m_run       = 0;
+    size_t                                    m_begin     = 0;
+    size_t                                    m_end       = 0;
+    size_t                                    m_chunkSize = 0;
+
+    /**
+     * Claims and runs chunks of the current run until none are left.
+     */
+    void runChunks();
+
+  public:
+    /**
+     * @param function Called as `function(rangeBegin, rangeEnd)` for every chunk.
+     */
+    ParallelLoop(JobSystem &jobSystem, std::function<void(size_t, size_t)> function);
+
+    /**
+     * Waits for helpers still queued from the last run to finish.
+     */
+    ~ParallelLoop();
+
+    ParallelLoop(const ParallelLoop &)            = delete;
+    ParallelLoop &operator=(const ParallelLoop &) = delete;
+
+    /**
+     * Runs the loop body over `[begin, end)` in chunks of at least `grainSize` items, as
+     * `parallelFor` does, and returns once every chunk is done.
+     */
+    void run(size_t begin, size_t end, size_t grainSize);
+  };
+
+private:
+  std::vector<std::unique_ptr<JobQueue>> m_queues;
+  JobQueue                               m_mainThreadQueue;
+  std::vector<std::thread>               m_workers;
+  std::thread::id                        m_mainThreadId;
+  std::atomic<size_t>                    m_queuedJobs{0};
+  std::mutex                             m_sleepMutex;
+  std::condition_variable                m_jobsQueued;
+  bool                                   m_stopping = false;
+
+  void schedule(const std::shared_ptr<Job> &job);
+  void execute(const std::shared_ptr<Job> &job);
+  bool runOneJob();
+  void workerLoop(size_t queueIndex);
+
+  /**
+   * The queue of the calling thread, or nullptr for threads that do not belong to the job
+   * system.
+   */
+  JobQueue *getOwnQueue();
+
+public:
+  /**
+   * @param threadCount Total threads running jobs, including the creating thread. Values
+   * below two create no workers.
+   */
+  explicit JobSystem(size_t threadCount = std::thread::hardware_concurrency());
+
+  /**
+   * Waits for the workers to finish the jobs they are running and stops them. Jobs that
+   * have not started are dropped.
+   */
+  ~JobSystem();
+
+  JobSystem(const JobSystem &)            = delete;
+  JobSystem &operator=(const JobSystem &) = delete;
+
+  /**
+   * Schedules a job to run once every dependency has finished.
+   */
+  JobHandle submit(std::function<void()>            function,
+                   std::initializer_list<JobHandle> dependencies = {},
+                   Lane                             lane         = Lane::ANY_THREAD);
+
+  /**
+   * Blocks until the job has finished, running other ready jobs in the meantime.
+   */
+  void wait(const JobHandle &handle);
+
+  /**
+   * Runs `function(rangeBegin, rangeEnd)` over consecutive chunks of `[begin, end)` of at
+   * least `grainSize` items, spread across the threads, and returns once every chunk is
+   * done. Small ranges run inline on the calling thread. Unlike `wait`, the calling thread
+   * runs no other jobs in the meantime, so the time the loop takes is its own.
+   */
+  void parallelFor(size_t                                   begin,
+                   size_t                                   end,
+                   size_t                                   grainSize,
+                   const std::function<void(size_t, size_t)> &function);
+
+  /**
+   * Runs the ready main thread lane jobs. Must be called on the creating thread, typically
+   * once per frame.
+   */
+  void runMainThreadJobs();
+
+  /**
+   * The number of threads running jobs, including the creating thread.
+   */
+  size_t getThreadCount() const;
+};
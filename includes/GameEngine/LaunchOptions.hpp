@@ -0,0 +1,29 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+
+/**
+ * Options passed to the game on the command line.
+ *
+ * --record <file>       Record every main scene session to the file, overwriting it.
+ * --replay <file>       Start directly in the main scene and replay the recorded session.
+ * --telemetry <file>    Log per-tick counters of every main scene session to the file.
+ * --frame-stats <file>  On exit, write per-scene frame time percentiles and hitch counts
+ *                       to the file, as CSV if it ends in .csv and as JSON otherwise.
+ * --stress <file>       Start directly in the stress test, write its scaling report to the
+ *                       file in the same formats, and quit when it finishes.
+ */
+struct LaunchOptions {
+  std::optional<std::filesystem::path> recordPath;
+  std::optional<std::filesystem::path> replayPath;
+  std::optional<std::filesystem::path> telemetryPath;
+  std::optional<std::filesystem::path> frameStatsPath;
+  std::optional<std::filesystem::path> stressReportPath;
+
+  /**
+   * Parses the command line. Unknown arguments and options missing a value are logged and
+   * ignored.
+   */
+  static LaunchOptions parse(int argc, char *argv[]);
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "../EntityManagement/Components.hpp"
+#include "../Helpers/Color.hpp"
+#include "../Helpers/Vec2.hpp"
+#include <SDL2/SDL.h>
+#include <SDL_ttf.h>
+#include <string>
+#include <vector>
+
+/**
+ * Everything needed to draw one frame of a scene, copied out of its simulation so the frame
+ * can be drawn while the simulation moves on. Holds no pointers into the simulation's state,
+ * so once written it is only ever read.
+ */
+struct DrawList {
+  /**
+   * How to draw one entity: a box in its colour, or its sprite when it has one.
+   */
+  struct Quad {
+    SDL_Rect    rect;
+    Color       color;
+    TextureName textureName;
+    bool        hasSprite;
+    bool        visible;
+  };
+
+  /**
+   * A line of text with its top left corner at the position.
+   */
+  struct TextRun {
+    const TTF_Font *font;
+    std::string     text;
+    SDL_Color       color;
+    Vec2            position;
+  };
+
+  std::vector<Quad>    quads;
+  std::vector<TextRun> textRuns;
+
+  /**
+   * Every live particle as a solid quad, four vertices each, ready to be batched.
+   */
+  std::vector<SDL_Vertex> particleVertices;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../AssetManagement/TextureManager.hpp"
+#include "../EntityManagement/EntityManager.hpp"
+#include "../GameEngine/JobSystem.hpp"
+#include "../Helpers/Color.hpp"
+#include "../SystemManagement/RenderBatcher.hpp"
+#include "./DrawList.hpp"
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Draws the entities of a simulation: a box in each entity's colour, or its sprite when it
+ * has one. Everything but enemies fades out over its lifespan.
+ *
+ * Working out each entity's rect and colour touches only its own components, so it runs on
+ * the job system. The quads are then batched on the calling thread and drawn with a draw
+ * call per texture, so overlapping boxes and sprites are layered by texture rather than by
+ * entity order. Sprites are drawn from the TextureManager's atlases, so sprites of every
+ * kind packed into the same atlas share a draw call.
+ *
+ * The two halves can also run apart: `build` writes the quads into a draw list off the main
+ * thread, and `draw` issues them later on the thread that owns the renderer.
+ */
+class EntityRenderer {
+  DrawList      m_drawList;
+  RenderBatcher m_batcher;
+
+public:
+  /**
+   * @param softwareRenderer The software render backend to draw with, or nullptr to draw
+   * with the SDL renderer.
+   */
+  explicit EntityRenderer(SoftwareRenderer *softwareRenderer = nullptr);
+
+  /**
+   * Replaces the draw list's quads with one per entity. Touches no SDL state, so it may run
+   * on any thread that owns the entities for the moment.
+   *
+   * @param currentTime The simulation time, in milliseconds, that lifespans fade against.
+   */
+  static void build(DrawList           &drawList,
+                    JobSystem          &jobSystem,
+                    const EntityVector &entities,
+                    std::uint64_t       currentTime);
+
+  /**
+   * Batches and draws the draw list's quads. Called on the main thread.
+   */
+  void draw(SDL_Renderer         *renderer,
+            const TextureManager &textureManager,
+            const DrawList       &drawList);
+
+  /**
+   * Builds and draws the entities in one go.
+   *
+   * @param currentTime The simulation time, in milliseconds, that lifespans fade against.
+   */
+  void render(SDL_Renderer         *renderer,
+              const TextureManager &textureManager,
+              JobSystem            &jobSystem,
+              const EntityVector   &entities,
+              std::uint64_t         currentTime);
+
+  /**
+   * The number of draw calls the last render issued.
+   */
+  size_t getDrawCallCount() const;
+};
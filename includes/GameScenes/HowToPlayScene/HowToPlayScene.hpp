@@ -1,10 +1,13 @@
 #pragma once
 
 #include "../../GameEngine/GameEngine.hpp"
+#include "../../SystemManagement/RenderCache.hpp"
 #include "../Scene.hpp"
 
 class HowToPlayScene final : public Scene {
 private:
+  RenderCache m_renderCache;
+
   void renderText() const;
 
 public:
@@ -16,5 +19,10 @@ public:
   void sDoAction(Action &action) override;
   void sAudio() override;
 
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isIdle() const override {
+    return true;
+  }
 };
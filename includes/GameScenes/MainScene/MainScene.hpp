@@ -1,30 +1,117 @@
 #pragma once
 
 #include "../../../includes/AssetManagement/AudioSampleQueue.hpp"
-#include "../../EntityManagement/EntityManager.hpp"
+#include "../../GameScenes/DrawList.hpp"
+#include "../../GameScenes/EntityRenderer.hpp"
+#include "../../GameScenes/ParticleRenderer.hpp"
 #include "../../GameScenes/Scene.hpp"
-#include "MainSceneSpawner.hpp"
+#include "../../Helpers/ParticleSystem.hpp"
+#include "../../Helpers/Profiler.hpp"
+#include "../../Simulation/InputRecording.hpp"
+#include "../../Simulation/MainSceneSimulation.hpp"
+#include "../../Simulation/RewindBuffer.hpp"
+#include "../../Simulation/SpawnBudgetController.hpp"
+#include "../../Simulation/TelemetryLog.hpp"
 #include <SDL2/SDL.h>
-#include <random>
+#include <memory>
+#include <optional>
+#include <vector>
 
+/**
+ * SDL front-end for the main gameplay scene.
+ *
+ * The gameplay itself lives in `MainSceneSimulation`; this scene feeds it input, steps it
+ * in fixed ticks as wall clock time passes, and renders and plays audio for its state.
+ *
+ * When the game is launched with `--record`, the session's input is recorded. With
+ * `--replay`, live gameplay input is ignored and the recorded input is fed back instead.
+ *
+ * Recent ticks are kept in a rewind buffer: the left arrow key steps back one tick and R
+ * rewinds one second, both pausing on the restored tick. Play resumes from there, discarding
+ * the ticks and recorded input after it.
+ *
+ * With `--telemetry`, entity populations, system counters and frame times are logged for
+ * every tick.
+ *
+ * F3 toggles an overlay of the rolling time per frame of each profiler zone, and F9 exports
+ * the recent zones of every thread as a Chrome trace.
+ *
+ * The measured simulation and render time of each frame is fed to a spawn budget controller,
+ * which throttles spawning and culls entities when frames run over the configured target.
+ * Its decisions are recorded with the input, and a replay applies the recorded ones instead.
+ *
+ * Movement and the per-entity half of rendering run on the engine's job system. Each frame
+ * the simulation is stepped in a job that ends by copying its state into a draw list, while
+ * the main thread, which owns every SDL call, draws and presents the draw list the previous
+ * frame's job wrote. The two lists are swapped once the job has been waited on, so what is
+ * on screen trails the simulation by a frame, but a slow present or a vsync wait no longer
+ * holds up the simulation. The job only runs within `update`, so input, rewinds and window
+ * resizes never race with it.
+ *
+ * Hits and pickups throw out bursts of particles where they happened. The particles are
+ * updated and laid out for drawing in the simulation job too, from the events its ticks
+ * raised, and drawn in a single batch. They are not part of the simulation, so rewinding
+ * clears them rather than restoring them.
+ */
 class MainScene final : public Scene {
 private:
-  Uint64                  m_lastNonPlayerEntitySpawnTime = 0;
-  Uint64                  m_lastFrameTime                = 0;
-  EntityManager           m_entities;
-  float                   m_deltaTime = 0;
-  bool                    m_paused    = false;
-  int                     m_score     = 0;
-  int                     m_lives     = 5;
-  std::shared_ptr<Entity> m_player;
-  Uint64                  m_timeRemaining = 2.5 * 60 * 1000;
-  bool                    m_gameOver      = false;
-  std::random_device      m_rd;
-  std::mt19937            m_randomGenerator     = std::mt19937(m_rd());
-  Uint64                  m_lastBulletSpawnTime = 0;
-  Uint64                  m_bulletSpawnCooldown = 90;
-  MainSceneSpawner        m_spawner;
-  void                    renderText() const;
+  Uint64                                  m_lastFrameTime    = 0;
+  Uint64                                  m_lastFrameCounter = 0;
+  Uint64                                  m_tickAccumulator  = 0;
+  Uint64                                  m_simulationEnd    = 0;
+  Uint64                                  m_renderEnd        = 0;
+  bool                                    m_paused           = false;
+  std::optional<InputRecording>           m_replayRecording;
+  std::uint32_t                           m_seed;
+  MainSceneSimulation                     m_simulation;
+  std::unique_ptr<InputRecorder>          m_recorder;
+  std::unique_ptr<InputReplayer>          m_replayer;
+  RewindBuffer                            m_rewindBuffer;
+  std::unique_ptr<TelemetryLogWriter>     m_telemetry;
+  SpawnBudgetController                   m_spawnBudgetController;
+  EntityRenderer                          m_entityRenderer;
+  ParticleSystem                          m_particles;
+  ParticleRenderer                        m_particleRenderer;
+  DrawList                                m_drawList;
+  DrawList                                m_nextDrawList;
+  std::optional<Profiler::ZoneStatistics> m_profilerStatistics;
+
+  /**
+   * Runs the ticks due after `deltaTime` milliseconds. Runs in the frame's simulation job.
+   */
+  void stepSimulation(Uint64 deltaTime, Uint64 tickDuration, std::uint32_t frameTime);
+
+  /**
+   * Emits a burst of particles for every hit and pickup raised since the events were last
+   * cleared, then moves the particles on by `deltaTime` milliseconds unless paused. Runs in
+   * the frame's simulation job.
+   */
+  void updateParticles(Uint64 deltaTime);
+
+  /**
+   * Copies the entities, the particles and the score, lives, time and effect text into the
+   * draw list.
+   */
+  void buildDrawList(DrawList &drawList);
+
+  /**
+   * Draws the rolling average and maximum time per frame of every profiler zone.
+   */
+  void renderProfilerOverlay() const;
+  void saveRecording();
+  void rewind(std::uint64_t ticks);
+
+  /**
+   * Feeds the time a frame's simulation job and drawing took together, in microseconds, to
+   * the spawn budget controller and applies and records any change it makes to the budget.
+   */
+  void updateSpawnBudget(std::uint32_t frameCost);
+
+  /**
+   * Loads the recording requested with `--replay`, if any, and restores the window size it
+   * was recorded with so the simulation is created with the same bounds.
+   */
+  static std::optional<InputRecording> loadReplayRecording(GameEngine *gameEngine);
 
 public:
   explicit MainScene(GameEngine *gameEngine);
@@ -36,17 +123,4 @@ public:
   void sRender() override;
   void sDoAction(Action &action) override;
   void sAudio() override;
-
-  void sCollision();
-  void sMovement();
-  void sSpawner();
-  void sLifespan();
-  void sEffects() const;
-  void sTimer();
-
-  int  getScore() const;
-  void setScore(int score);
-  void decrementLives();
-
-  void setGameOver();
 };
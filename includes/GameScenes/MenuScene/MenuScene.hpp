@@ -1,6 +1,7 @@
 #pragma once
 #include "../../GameEngine/Action.hpp"
 #include "../../GameEngine/GameEngine.hpp"
+#include "../../SystemManagement/RenderCache.hpp"
 #include "../Scene.hpp"
 #include <map>
 #include <string>
@@ -11,6 +12,7 @@ private:
   bool         m_playButtonClicked         = false;
   bool         m_instructionsButtonClicked = false;
   unsigned int m_selectedIndex             = 0;
+  RenderCache  m_renderCache;
 
 public:
   explicit MenuScene(GameEngine *gameEngine);
@@ -19,5 +21,10 @@ public:
   void sRender() override;
   void sDoAction(Action &action) override;
   void sAudio() override;
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isIdle() const override {
+    return true;
+  }
 };
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../GameEngine/JobSystem.hpp"
+#include "../Helpers/ParticleSystem.hpp"
+#include "../SystemManagement/RenderBatcher.hpp"
+#include "./DrawList.hpp"
+#include <SDL2/SDL.h>
+
+/**
+ * Draws a particle system's particles as solid squares, fading out over their lifetime.
+ *
+ * As with `EntityRenderer`, the work is split in two: `build` lays every particle's vertices
+ * out in a draw list in parallel on the job system, off the main thread, and `draw` copies
+ * them into a single batch, so every particle is drawn with one `SDL_RenderGeometry` call.
+ */
+class ParticleRenderer {
+  RenderBatcher m_batcher;
+
+public:
+  /**
+   * @param softwareRenderer The software render backend to draw with, or nullptr to draw
+   * with the SDL renderer.
+   */
+  explicit ParticleRenderer(SoftwareRenderer *softwareRenderer = nullptr);
+
+  /**
+   * Replaces the draw list's particle vertices with the live particles'. Touches no SDL
+   * state, so it may run on any thread that owns the particle system for the moment.
+   */
+  static void build(DrawList &drawList, JobSystem &jobSystem, const ParticleSystem &particles);
+
+  /**
+   * Batches and draws the draw list's particles. Called on the main thread.
+   */
+  void draw(SDL_Renderer *renderer, const DrawList &drawList);
+
+  /**
+   * The number of draw calls the last draw issued.
+   */
+  size_t getDrawCallCount() const;
+};
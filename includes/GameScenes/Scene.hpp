@@ -30,6 +30,14 @@ public:
 
   virtual void onSceneWindowResize() = 0;
 
+  // Called when the renderer has dropped the contents of its render target textures.
+  virtual void onRenderTargetsReset() {}
+
+  // Idle scenes only change on input, so the engine waits for events instead of polling.
+  virtual bool isIdle() const {
+    return false;
+  }
+
   void registerAction(const int inputKey, const std::string &actionName) {
     m_actionMap[inputKey] = actionName;
   }
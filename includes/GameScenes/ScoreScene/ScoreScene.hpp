@@ -2,11 +2,13 @@
 
 #include "../../GameEngine/GameEngine.hpp"
 #include "../../GameScenes/Scene.hpp"
+#include "../../SystemManagement/RenderCache.hpp"
 
 class ScoreScene final : public Scene {
 private:
   unsigned int m_score;
   unsigned int m_selectedIndex = 0;
+  RenderCache  m_renderCache;
   void         renderText() const;
 
 public:
@@ -17,5 +19,10 @@ public:
   void sRender() override;
   void sDoAction(Action &action) override;
   void sAudio() override;
-  void onSceneWindowResize() override {};
+  void onSceneWindowResize() override;
+  void onRenderTargetsReset() override;
+
+  bool isIdle() const override {
+    return true;
+  }
 };
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../../GameEngine/GameEngine.hpp"
+#include "../../GameScenes/EntityRenderer.hpp"
+#include "../../GameScenes/Scene.hpp"
+#include "../../Simulation/MainSceneSimulation.hpp"
+#include "../../Simulation/StressScenario.hpp"
+#include <SDL2/SDL.h>
+
+/**
+ * Measures how the game's systems scale with the number of entities.
+ *
+ * The scene runs the stages configured under `stressConfig`, keeping each tag's population
+ * at the stage's target, and times the real movement, collision, lifespan, effects and
+ * render systems on every frame. It shows the live entity counts and system timings, and
+ * logs a scaling report once the last stage is done.
+ *
+ * With `--stress`, the game starts in this scene, writes the report to the given file and
+ * quits when the test finishes. Otherwise, it returns to the menu; backspace leaves early.
+ */
+class StressScene final : public Scene {
+private:
+  MainSceneSimulation m_simulation;
+  StressScenario      m_scenario;
+  EntityRenderer      m_entityRenderer;
+  StressFrameSample   m_sample;
+  StressFrameSample   m_lastSample;
+
+  void renderOverlay();
+  void logReport() const;
+
+public:
+  explicit StressScene(GameEngine *gameEngine);
+
+  void update() override;
+  void onEnd() override;
+  void sRender() override;
+  void sDoAction(Action &action) override;
+  void sAudio() override;
+  void onSceneWindowResize() override;
+};
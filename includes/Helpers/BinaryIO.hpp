@@ -0,0 +1,81 @@
+#pragma once
+
+#include "./Vec2.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class BinaryFormatError : public std::runtime_error {
+public:
+  explicit BinaryFormatError(const std::string &message) :
+      std::runtime_error(message) {}
+};
+
+/**
+ * Appends little-endian fixed-width values, LEB128 varints and length-prefixed strings to a
+ * byte buffer.
+ */
+class BinaryWriter {
+  std::vector<std::uint8_t> m_buffer;
+
+public:
+  void writeU8(std::uint8_t value);
+  void writeU16(std::uint16_t value);
+  void writeU32(std::uint32_t value);
+  void writeU64(std::uint64_t value);
+  void writeFloat(float value);
+  void writeVec2(const Vec2 &value);
+  void writeVarint(std::uint64_t value);
+  void writeSignedVarint(std::int64_t value);
+  void writeString(const std::string &value);
+  void writeBytes(const void *data, size_t size);
+
+  const std::vector<std::uint8_t> &getBuffer() const;
+  void                             clear();
+};
+
+/**
+ * Reads the values written by `BinaryWriter` back from a byte buffer.
+ *
+ * @throws BinaryFormatError when a read runs past the end of the buffer.
+ */
+class BinaryReader {
+  const std::uint8_t *m_data;
+  size_t              m_size;
+  size_t              m_offset = 0;
+
+  const std::uint8_t *take(size_t size);
+
+public:
+  BinaryReader(const std::uint8_t *data, size_t size);
+  explicit BinaryReader(const std::vector<std::uint8_t> &buffer);
+
+  std::uint8_t  readU8();
+  std::uint16_t readU16();
+  std::uint32_t readU32();
+  std::uint64_t readU64();
+  float         readFloat();
+  Vec2          readVec2();
+  std::uint64_t readVarint();
+  std::int64_t  readSignedVarint();
+  std::string   readString();
+  void          readBytes(void *data, size_t size);
+
+  bool   isAtEnd() const;
+  size_t getOffset() const;
+};
+
+namespace BinaryHelpers {
+  /**
+   * @throws BinaryFormatError if the file cannot be read.
+   */
+  std::vector<std::uint8_t> readFile(const std::filesystem::path &path);
+
+  /**
+   * @throws BinaryFormatError if the file cannot be written.
+   */
+  void writeFile(const std::filesystem::path &path, const std::vector<std::uint8_t> &bytes);
+} // namespace BinaryHelpers
@@ -1,16 +1,17 @@
 #pragma once
 
 #include <bitset>
+#include <cstdint>
 #include <functional>
-#include <iostream>
 #include <memory>
-#include <random>
+#include <vector>
 
-#include "../AssetManagement/AudioSampleQueue.hpp"
 #include "../EntityManagement/Entity.hpp"
 #include "../EntityManagement/EntityManager.hpp"
 #include "../Helpers/Vec2.hpp"
-#include "../SystemManagement/AudioManager.hpp"
+#include "../Simulation/ExpiryTimers.hpp"
+#include "../Simulation/GameEvent.hpp"
+#include "../Simulation/SimulationRandom.hpp"
 
 namespace CollisionHelpers {
 
@@ -36,16 +37,23 @@ namespace CollisionHelpers::MainScene {
 
   struct GameState {
     EntityManager                  &entityManager;
-    std::mt19937                   &randomGenerator;
+    const SimulationRandom         &random;
     const int                       score;
     const std::function<void(int)> &setScore;
     const std::function<void()>     decrementLives;
-    AudioSampleQueue               &audioSampleManager;
+    std::vector<GameEvent>         &events;
     const Vec2                      windowSize;
+    const std::uint64_t             currentTime;
+    ExpiryTimers                   &expiryTimers;
   };
 
   void handleEntityBounds(const std::shared_ptr<Entity> &entity, const Vec2 &windowSize);
-  void handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args);
+  /**
+   * Applies the gameplay rules for entity A running into entity B.
+   *
+   * @returns Whether the two entities overlapped.
+   */
+  bool handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args);
 
 } // namespace CollisionHelpers::MainScene
 
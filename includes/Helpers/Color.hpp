@@ -0,0 +1,14 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * RGBA color used by the simulation core.
+ *
+ * Layout-compatible with SDL_Color so the front-end can hand it to SDL directly.
+ */
+struct Color {
+  std::uint8_t r = 0;
+  std::uint8_t g = 0;
+  std::uint8_t b = 0;
+  std::uint8_t a = 0;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../Configuration/Config.hpp"
+#include "./FrameTimeHistogram.hpp"
+
+#include <chrono>
+
+/**
+ * Holds the native main loop to a target frame rate and measures how closely it does.
+ *
+ * In `CAP` mode, `waitForNextFrame` sleeps until shortly before the next frame is due and
+ * spins for the rest, since a sleep can overshoot by the scheduler's granularity. The spin
+ * margin is the configured threshold plus a running average of how far recent sleeps
+ * overshot, so it adapts to the platform's timer resolution. Frames are scheduled at fixed
+ * intervals; a late frame moves the schedule rather than being made up with short ones.
+ *
+ * In `VSYNC` mode presenting does the waiting, and the pacer only measures against the
+ * display's refresh rate. `UNCAPPED` neither waits nor measures.
+ */
+class FramePacer {
+  using Clock = std::chrono::steady_clock;
+
+  FramePacingMode    m_mode;
+  float              m_frameRate;
+  Clock::duration    m_frameDuration;
+  Clock::duration    m_spinThreshold;
+  Clock::duration    m_sleepOvershoot = Clock::duration::zero();
+  Clock::time_point  m_nextFrame;
+  Clock::time_point  m_lastFrameEnd;
+  FrameTimeHistogram m_pacingErrors;
+
+  void sleepUntil(Clock::time_point deadline);
+
+public:
+  /**
+   * @param frameRate The targeted frames per second: the cap in `CAP` mode and the display's
+   * refresh rate in `VSYNC` mode.
+   * @param spinThreshold The least time, in milliseconds, spun rather than slept before a
+   * frame is due.
+   */
+  FramePacer(FramePacingMode mode, float frameRate, float spinThreshold);
+
+  /**
+   * Called at the end of every frame. Returns once the next frame is due.
+   */
+  void waitForNextFrame();
+
+  /**
+   * Forgets the previous frame, so the next is neither held back nor measured against it.
+   * Called after the loop has deliberately waited, such as for the events of an idle scene.
+   */
+  void reset();
+
+  FramePacingMode getMode() const;
+  float           getFrameRate() const;
+
+  /**
+   * How far each frame's duration landed from the target, in microseconds. Frames off by
+   * more than a millisecond count as hitches.
+   */
+  const FrameTimeHistogram &getPacingErrors() const;
+};
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Counts frame durations in log-linear buckets, in the style of HdrHistogram.
+ *
+ * Durations are in microseconds. Below 128 µs every value has its own bucket; above, every
+ * power of two is split into 64 buckets, so a reported percentile is within 1/64 of the
+ * true value. Recording is constant time and the histogram never allocates.
+ */
+class FrameTimeHistogram {
+public:
+  /**
+   * Values below this are counted exactly.
+   */
+  static constexpr std::uint32_t EXACT_LIMIT = 128;
+
+  /**
+   * Frames longer than this many times the intended frame duration count as hitches.
+   */
+  static constexpr std::uint32_t HITCH_TARGET_MULTIPLE = 2;
+
+  static constexpr size_t BUCKET_COUNT =
+      EXACT_LIMIT + (32 - std::countr_zero(EXACT_LIMIT)) * (EXACT_LIMIT / 2);
+
+private:
+  std::array<std::uint64_t, BUCKET_COUNT> m_counts{};
+  std::uint64_t                           m_count      = 0;
+  std::uint64_t                           m_totalTime  = 0;
+  std::uint32_t                           m_maxTime    = 0;
+  std::uint64_t                           m_hitchCount = 0;
+  std::uint32_t                           m_hitchThreshold;
+
+  static size_t        getBucketIndex(std::uint32_t frameTime);
+  static std::uint32_t getBucketUpperBound(size_t bucketIndex);
+
+public:
+  /**
+   * @param hitchThreshold Frames longer than this, in microseconds, count as hitches.
+   */
+  explicit FrameTimeHistogram(std::uint32_t hitchThreshold);
+
+  void record(std::uint32_t frameTime);
+
+  /**
+   * The duration that `percentile` percent of frames took at most, e.g. 99.9 for p99.9. Zero
+   * when nothing has been recorded.
+   */
+  std::uint32_t getPercentile(double percentile) const;
+
+  std::uint64_t getCount() const;
+  std::uint32_t getMax() const;
+  float         getMean() const;
+  std::uint64_t getHitchCount() const;
+  std::uint32_t getHitchThreshold() const;
+};
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "./FrameTimeHistogram.hpp"
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Frame time statistics for every scene shown, in the order they were loaded.
+ *
+ * Each scene load starts a fresh histogram. The frame during which a scene is loaded usually
+ * spikes on the loading itself, so it is kept apart from the histogram as the scene's
+ * transition frame rather than counted against either scene's steady state. The scene shown
+ * at startup is loaded before the first frame, whose duration is its transition frame.
+ */
+class FrameTimeLog {
+public:
+  struct SceneFrameTimes {
+    std::string                  sceneName;
+    FrameTimeHistogram           histogram;
+    std::optional<std::uint32_t> transitionTime;
+  };
+
+private:
+  std::uint32_t                m_hitchThreshold;
+  std::vector<SceneFrameTimes> m_scenes;
+
+public:
+  /**
+   * @param frameTimeTarget The intended frame duration, in microseconds. Frames longer than
+   * twice the target count as hitches.
+   */
+  explicit FrameTimeLog(std::uint32_t frameTimeTarget);
+
+  /**
+   * Starts the statistics of a newly loaded scene. The next recorded frame is its transition.
+   */
+  void beginScene(const std::string &sceneName);
+
+  /**
+   * Records a frame's duration, in microseconds, against the latest scene. Ignored before
+   * any scene has begun.
+   */
+  void record(std::uint32_t frameTime);
+
+  const std::vector<SceneFrameTimes> &getScenes() const;
+
+  /**
+   * Writes the count, mean, p50, p90, p99, p99.9, maximum, hitch count and transition time
+   * of every scene, in microseconds, as CSV when the path ends in `.csv` and as JSON
+   * otherwise.
+   *
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  void save(const std::filesystem::path &path) const;
+};
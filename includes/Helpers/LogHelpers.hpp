@@ -0,0 +1,19 @@
+#pragma once
+#include <functional>
+#include <string>
+
+/**
+ * Logging for the simulation core.
+ *
+ * The core has no SDL dependency, so messages go to stderr unless the host installs a sink
+ * (the SDL front-end forwards them to SDL_Log).
+ */
+namespace LogHelpers {
+  enum class LogLevel { INFO, ERROR };
+
+  typedef std::function<void(LogLevel, const std::string &)> LogSink;
+
+  void setLogSink(LogSink sink);
+  void logInfo(const char *format, ...);
+  void logError(const char *format, ...);
+} // namespace LogHelpers
@@ -4,7 +4,7 @@
 #include "../EntityManagement/Components.hpp"
 #include "../EntityManagement/Entity.hpp"
 #include "../Helpers/Vec2.hpp"
-#include <SDL2/SDL.h>
+#include <cstdint>
 #include <memory>
 
 namespace MovementHelpers {
@@ -24,5 +24,7 @@ namespace MovementHelpers {
 
   void moveBullets(const std::shared_ptr<Entity> &entity, const float &deltaTime);
 
-  void moveItems(const std::shared_ptr<Entity> &entity, const float &deltaTime);
+  void moveItems(const std::shared_ptr<Entity> &entity,
+                 const float                   &deltaTime,
+                 std::uint64_t                  currentTime);
 } // namespace MovementHelpers
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "./Color.hpp"
+#include "./Vec2.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * A fixed-capacity pool of short-lived, purely cosmetic particles, such as the sparks of a
+ * hit or a pickup. Particles are not part of the simulation: they are never saved, hashed or
+ * rewound, and drawing them takes no random numbers from it.
+ *
+ * The pool is laid out as a structure of arrays, one array per field, with the live
+ * particles packed at the front. Every array is allocated up front, so emitting and updating
+ * never allocate, and bursts emitted while the pool is full lose the particles that do not
+ * fit. Particles that die are replaced by the last live one, so their order is not kept.
+ *
+ * Updating moves and ages four particles at a time with SSE2 where available, and one at a
+ * time otherwise. Particles slow down as they age, and fade out over their lifetime.
+ */
+class ParticleSystem {
+public:
+  /**
+   * Particles thrown out in every direction from a point.
+   */
+  struct Burst {
+    Vec2          position;
+    std::uint32_t count;
+    Color         color;
+
+    /**
+     * The range of speeds the particles start at, in pixels per second.
+     */
+    float minSpeed;
+    float maxSpeed;
+
+    /**
+     * The range of lifetimes the particles live for, in seconds.
+     */
+    float minLifetime;
+    float maxLifetime;
+
+    /**
+     * The width and height of each particle, in pixels.
+     */
+    float size;
+  };
+
+private:
+  size_t             m_capacity;
+  size_t             m_count      = 0;
+  std::uint64_t      m_burstCount = 0;
+  std::vector<float> m_positionX;
+  std::vector<float> m_positionY;
+  std::vector<float> m_velocityX;
+  std::vector<float> m_velocityY;
+  std::vector<float> m_remainingLifetime;
+  std::vector<float> m_inverseLifetime;
+  std::vector<float> m_size;
+  std::vector<Color> m_color;
+
+  /**
+   * Kills the particles whose lifetime has run out.
+   */
+  void removeDead();
+
+public:
+  explicit ParticleSystem(size_t capacity);
+
+  /**
+   * Adds a burst's particles to the pool, as many as fit.
+   */
+  void emit(const Burst &burst);
+
+  /**
+   * Moves and ages every particle by `deltaTime` seconds, and kills those whose lifetime
+   * has run out.
+   */
+  void update(float deltaTime);
+
+  /**
+   * Kills every particle.
+   */
+  void clear();
+
+  size_t getCount() const;
+  size_t getCapacity() const;
+
+  /**
+   * The fields of the live particles, `getCount()` of each.
+   */
+  const float *getPositionX() const;
+  const float *getPositionY() const;
+  const float *getSize() const;
+  const Color *getColor() const;
+
+  /**
+   * How much of its lifetime each particle has left, from 1 when emitted to 0 when it dies.
+   */
+  float getRemainingFraction(size_t index) const;
+};
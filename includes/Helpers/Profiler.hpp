@@ -0,0 +1,134 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string_view>
+#include <vector>
+
+/**
+ * Scoped timing zones for finding where a frame's time goes.
+ *
+ * `PROFILE_ZONE("name")` times the rest of the enclosing scope. Every thread writes its zones
+ * to its own ring buffer without locking, keeping the most recent ones; readers copy them out
+ * with a `ZoneCursor`. The latest zones of every thread can be exported as a Chrome trace, and
+ * `ZoneStatistics` keeps rolling per-zone averages and maxima for an on-screen overlay.
+ *
+ * Building with `YERB_PROFILER_DISABLED` defined compiles every zone out.
+ */
+namespace Profiler {
+  /**
+   * A finished zone. Times are in nanoseconds since the profiler's first use.
+   */
+  struct Zone {
+    const char   *name;
+    std::uint64_t start;
+    std::uint64_t end;
+    std::uint32_t threadIndex;
+  };
+
+  std::uint64_t now();
+
+  /**
+   * Appends a zone to the calling thread's ring buffer, overwriting its oldest zone when full.
+   *
+   * @param name A string with static storage duration, such as a literal.
+   */
+  void recordZone(const char *name, std::uint64_t start, std::uint64_t end);
+
+  /**
+   * Records a zone from its construction to its destruction.
+   */
+  class ScopedZone {
+    const char   *m_name;
+    std::uint64_t m_start;
+
+  public:
+    explicit ScopedZone(const char *name);
+    ~ScopedZone();
+
+    ScopedZone(const ScopedZone &)            = delete;
+    ScopedZone &operator=(const ScopedZone &) = delete;
+  };
+
+  /**
+   * A reader's position in every thread's ring buffer.
+   */
+  class ZoneCursor {
+    std::vector<std::uint64_t> m_positions;
+
+  public:
+    /**
+     * Appends the zones recorded since the previous read, or every zone still buffered on the
+     * first read. Zones overwritten before they could be read are skipped.
+     */
+    void read(std::vector<Zone> &zones);
+
+    /**
+     * Moves past every zone recorded so far.
+     */
+    void skip();
+  };
+
+  /**
+   * Writes every zone still buffered as Chrome trace event JSON, which can be opened in
+   * chrome://tracing or Perfetto.
+   *
+   * @returns The number of zones written.
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  size_t exportChromeTrace(const std::filesystem::path &path);
+
+  /**
+   * Rolling per-zone time over the most recent frames. Zones with the same name are summed
+   * within a frame.
+   */
+  class ZoneStatistics {
+  public:
+    static constexpr size_t WINDOW_FRAMES = 120;
+
+    struct Summary {
+      std::string_view name;
+      float            averageTime;
+      float            maxTime;
+    };
+
+  private:
+    struct History {
+      std::array<std::uint64_t, WINDOW_FRAMES> frameTimes{};
+      std::uint64_t                            totalTime = 0;
+    };
+
+    ZoneCursor                          m_cursor;
+    std::vector<Zone>                   m_zones;
+    std::map<std::string_view, History> m_histories;
+    size_t                              m_frameCount = 0;
+
+  public:
+    /**
+     * Starts from the zones recorded after construction.
+     */
+    ZoneStatistics();
+
+    /**
+     * Reads the zones recorded since the previous call as one frame.
+     */
+    void update();
+
+    /**
+     * The average and maximum time per frame of every zone seen so far, in milliseconds,
+     * most expensive first.
+     */
+    std::vector<Summary> getSummaries() const;
+  };
+} // namespace Profiler
+
+#ifdef YERB_PROFILER_DISABLED
+#define PROFILE_ZONE(name)
+#else
+#define PROFILE_ZONE_CONCAT_INNER(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name)                                                                    \
+  const Profiler::ScopedZone PROFILE_ZONE_CONCAT(profileZone, __LINE__)(name)
+#endif
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * A sequence of random numbers from the Philox4x32-10 counter-based generator (Salmon et al.,
+ * "Parallel Random Numbers: As Easy as 1, 2, 3").
+ *
+ * Philox hashes a 128-bit counter under a 64-bit key into four 32-bit outputs. A stream is
+ * named by a key, a tick and a subject such as an entity id, and draws its outputs from
+ * consecutive counters under that name. Streams with different names never overlap and share
+ * no state, so they can be created and drawn from in any order or on any thread and still
+ * produce the same numbers.
+ *
+ * Every draw consumes exactly one output, without rejection sampling, so the position of a
+ * value in a stream does not depend on earlier values.
+ */
+class RandomStream {
+  std::array<std::uint32_t, 4> m_counter;
+  std::array<std::uint32_t, 2> m_key;
+  std::array<std::uint32_t, 4> m_block{};
+  size_t                       m_nextOutput;
+
+public:
+  RandomStream(std::uint64_t key, std::uint64_t tick, std::uint32_t subject);
+
+  std::uint32_t nextU32();
+
+  /**
+   * A value in [0, bound). Values are scaled rather than rejected, so with bounds far below
+   * 2^32 the bias is negligible.
+   */
+  std::uint32_t nextBelow(std::uint32_t bound);
+
+  /**
+   * A value in [min, max], both inclusive.
+   */
+  int nextInt(int min, int max);
+
+  /**
+   * A value in [0, 1).
+   */
+  float nextFloat();
+};
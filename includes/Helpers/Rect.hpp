@@ -0,0 +1,13 @@
+#pragma once
+
+/**
+ * Integer rectangle used by the simulation core.
+ *
+ * Layout-compatible with SDL_Rect so the front-end can hand it to SDL directly.
+ */
+struct Rect {
+  int x = 0;
+  int y = 0;
+  int w = 0;
+  int h = 0;
+};
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../GameEngine/JobSystem.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Draws axis-aligned quads, solid or textured, into an ARGB8888 frame in memory, for hosts
+ * where the GPU is missing and SDL's generic software renderer would be the bottleneck.
+ *
+ * Quads are queued and drawn on `flush`. The frame is split into tiles a band of rows tall,
+ * which are drawn in parallel on the job system. Before drawing, one pass sorts the queued
+ * quads into the tiles they overlap, keeping the order they were queued in, so each tile
+ * only visits its own quads and overlapping quads layer exactly as they would drawn one
+ * after another, whatever the thread count.
+ *
+ * Spans are filled and blended four pixels at a time with SSE2 where available, which every
+ * x86-64 CPU has, and a pixel at a time otherwise. Both paths round the same way, so the
+ * frame does not depend on which one ran. Blending follows SDL's `SDL_BLENDMODE_BLEND`, and
+ * textures are sampled nearest-neighbour and modulated by the quad's colour.
+ */
+class SoftwareRasterizer {
+public:
+  /**
+   * Pixels in ARGB8888 with straight alpha, row after row.
+   */
+  struct Image {
+    int                        width  = 0;
+    int                        height = 0;
+    std::vector<std::uint32_t> pixels = {};
+  };
+
+  /**
+   * Covers the pixels whose centres lie within `[left, right)` and `[top, bottom)`.
+   */
+  struct Quad {
+    int           left;
+    int           top;
+    int           right;
+    int           bottom;
+    std::uint32_t color;
+
+    /**
+     * The texture stretched over the quad, or nullptr for a solid colour.
+     */
+    const Image *image = nullptr;
+
+    /**
+     * The part of the image drawn, in normalized texture coordinates.
+     */
+    float texLeft   = 0;
+    float texTop    = 0;
+    float texRight  = 1;
+    float texBottom = 1;
+
+    /**
+     * Whether the quad is blended over the frame, or replaces it.
+     */
+    bool blend = true;
+  };
+
+private:
+  JobSystem                 &m_jobSystem;
+  int                        m_width  = 0;
+  int                        m_height = 0;
+  std::vector<std::uint32_t> m_pixels;
+  std::vector<Quad>          m_quads;
+  std::uint32_t              m_clearColor  = 0;
+  bool                       m_clearQueued = false;
+
+  /**
+   * The indices of the quads overlapping each tile, tile after tile, and where each tile's
+   * indices start, with one more entry marking the end of the last.
+   */
+  std::vector<std::uint32_t> m_tileQuads;
+  std::vector<size_t>        m_tileStarts;
+
+  void sortQuadsIntoTiles(size_t tileCount);
+  void drawTile(size_t tile, int top, int bottom);
+  void drawQuad(const Quad &quad, int top, int bottom);
+
+public:
+  explicit SoftwareRasterizer(JobSystem &jobSystem);
+
+  /**
+   * Resizes the frame, discarding its contents and the queued quads.
+   */
+  void resize(int width, int height);
+
+  /**
+   * Queues filling the whole frame with the colour, beneath every quad queued after it.
+   * Quads queued before it are dropped.
+   */
+  void clear(std::uint32_t color);
+
+  void addQuad(const Quad &quad);
+
+  /**
+   * Draws the queued quads into the frame.
+   */
+  void flush();
+
+  int                  getWidth() const;
+  int                  getHeight() const;
+  const std::uint32_t *getPixels() const;
+
+  /**
+   * Packs a colour into the frame's pixel format.
+   */
+  static std::uint32_t packColor(std::uint8_t r,
+                                 std::uint8_t g,
+                                 std::uint8_t b,
+                                 std::uint8_t a);
+};
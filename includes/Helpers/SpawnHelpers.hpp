@@ -1,19 +1,20 @@
 #pragma once
 
-#include "../../includes/AssetManagement/TextureManager.hpp"
 #include "../Configuration/ConfigManager.hpp"
 #include "../EntityManagement/Entity.hpp"
 #include "../EntityManagement/EntityManager.hpp"
+#include "../Helpers/RandomStream.hpp"
 #include "../Helpers/Vec2.hpp"
 
-#include <SDL2/SDL.h>
-#include <iostream>
 #include <memory>
-#include <random>
 
 namespace SpawnHelpers {
-  Vec2 createRandomPosition(std::mt19937 &randomGenerator, const Vec2 &windowSize);
-  Vec2 createValidVelocity(std::mt19937 &randomGenerator, int attempts = 5);
+  Vec2 createRandomPosition(RandomStream &randomStream, const Vec2 &windowSize);
+
+  /**
+   * A unit velocity along one of the eight axis and diagonal directions, each equally likely.
+   */
+  Vec2 createValidVelocity(RandomStream &randomStream);
   bool validateSpawnPosition(const std::shared_ptr<Entity> &entity,
                              const std::shared_ptr<Entity> &player,
                              EntityManager                 &entityManager,
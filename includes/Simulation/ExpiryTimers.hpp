@@ -0,0 +1,80 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <vector>
+
+/**
+ * Deadlines for entity lifespans and player effects, kept in min-heaps so each tick only
+ * visits the timers that are due instead of every entity.
+ *
+ * Timers are scheduled where a `CLifespan` or an effect is created. A timer does not own its
+ * entity, and it is checked against the entity's current state when it fires: timers of
+ * destroyed entities and removed effects are dropped, and a lifespan that has been extended
+ * is rescheduled. A lifespan that is shortened must be scheduled again.
+ */
+class ExpiryTimers {
+  struct Timer {
+    std::uint64_t         deadline;
+    std::uint64_t         sequence;
+    std::weak_ptr<Entity> entity;
+    Effect                effect;
+
+    bool operator>(const Timer &other) const;
+  };
+
+  /**
+   * A min-heap of timers that can be emptied without releasing its storage.
+   */
+  class TimerHeap : public std::priority_queue<Timer, std::vector<Timer>, std::greater<>> {
+  public:
+    void clear() {
+      c.clear();
+    }
+  };
+
+  TimerHeap     m_lifespanTimers;
+  TimerHeap     m_effectTimers;
+  std::uint64_t m_nextSequence = 0;
+
+public:
+  /**
+   * Schedules the expiry of the entity's `CLifespan`. Does nothing if it has none.
+   */
+  void scheduleLifespan(const std::shared_ptr<Entity> &entity);
+
+  /**
+   * Schedules the removal of an effect that was just added to the entity's `CEffects`.
+   */
+  void scheduleEffect(const std::shared_ptr<Entity> &entity, const Effect &effect);
+
+  /**
+   * Destroys the entities whose lifespan ended before `currentTime`.
+   *
+   * @returns The number of entities destroyed.
+   */
+  size_t expireLifespans(std::uint64_t currentTime);
+
+  /**
+   * Removes the effects whose duration ended before `currentTime`.
+   *
+   * @returns The number of effects removed.
+   */
+  size_t expireEffects(std::uint64_t currentTime);
+
+  /**
+   * Replaces every timer with ones for the lifespans and effects of the manager's entities,
+   * e.g. after its contents have been restored from a snapshot.
+   */
+  void rebuild(EntityManager &entityManager);
+
+  /**
+   * Drops every timer, as if none had ever been scheduled, keeping the heaps' storage.
+   */
+  void clear();
+
+  size_t getTimerCount() const;
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../Helpers/Vec2.hpp"
+
+/**
+ * The kinds of gameplay event raised by the simulation.
+ */
+enum class GameEventType {
+  SHOOT,
+  BULLET_HIT_ENEMY,
+  BULLET_HIT_WALL,
+  PLAYER_HIT_ENEMY,
+  SLOWNESS_ACQUIRED,
+  SPEED_BOOST_ACQUIRED,
+  ITEM_ACQUIRED,
+};
+
+/**
+ * A gameplay event raised by the simulation.
+ *
+ * The simulation has no audio or rendering of its own; it records what happened during a
+ * tick and where, and the front-end drains the events to play samples, emit particles, etc.
+ */
+struct GameEvent {
+  GameEventType type;
+
+  /**
+   * Where in the window the event happened: the centre of the entity hit or picked up, or
+   * of the player when shooting.
+   */
+  Vec2 position;
+};
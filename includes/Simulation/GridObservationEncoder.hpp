@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "../Helpers/Vec2.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Rasterizes the entities of a simulation into a low-resolution occupancy tensor.
+ *
+ * The output is planar, laid out as `[channel][row][column]`. There is one occupancy channel
+ * per `EntityTags` value, followed by optional x and y velocity channels. A cell is occupied
+ * when an entity's bounding box overlaps any part of it, so entities smaller than a cell
+ * still show up.
+ *
+ * Float buffers store occupancy as 1 and velocity divided by the velocity scale, clamped to
+ * [-1, 1]. Byte buffers store occupancy as 255 and velocity mapped to [1, 255] with 128 as
+ * zero.
+ */
+class GridObservationEncoder {
+public:
+  static constexpr size_t TAG_CHANNEL_COUNT = static_cast<size_t>(EntityTags::Default) + 1;
+
+private:
+  size_t m_width;
+  size_t m_height;
+  bool   m_includeVelocity;
+  float  m_velocityScale;
+
+  // Cell-space bounding boxes gathered from the entity list, reused between calls.
+  std::vector<std::int32_t> m_cellLeft;
+  std::vector<std::int32_t> m_cellTop;
+  std::vector<std::int32_t> m_cellRight;
+  std::vector<std::int32_t> m_cellBottom;
+  std::vector<std::uint8_t> m_channels;
+  std::vector<float>        m_velocityX;
+  std::vector<float>        m_velocityY;
+
+  void gather(EntityManager &entityManager, const Vec2 &worldSize);
+  template <typename T> void rasterize(T *output) const;
+
+public:
+  /**
+   * @param width The number of columns in the grid.
+   * @param height The number of rows in the grid.
+   * @param includeVelocity Whether to append the x and y velocity channels.
+   * @param velocityScale The velocity magnitude that maps to the edge of the value range.
+   *
+   * @throws std::runtime_error if the grid is empty or the velocity scale is not positive.
+   */
+  GridObservationEncoder(size_t width,
+                         size_t height,
+                         bool   includeVelocity = true,
+                         float  velocityScale   = 1.0f);
+
+  size_t getWidth() const;
+  size_t getHeight() const;
+  size_t getChannelCount() const;
+
+  /**
+   * The number of elements the output buffer must hold.
+   */
+  size_t getBufferSize() const;
+
+  /**
+   * Encodes every active entity into `output`, which must hold `getBufferSize()` elements.
+   *
+   * @param entityManager The entities to encode.
+   * @param worldSize The size of the area mapped onto the grid, usually the window size.
+   * @param output The caller-provided buffer to overwrite.
+   */
+  void encode(EntityManager &entityManager, const Vec2 &worldSize, float *output);
+  void encode(EntityManager &entityManager, const Vec2 &worldSize, std::uint8_t *output);
+};
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "../Configuration/ConfigManager.hpp"
+#include "../GameEngine/Action.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * A single input applied to the simulation before the update of `tick`.
+ */
+struct RecordedAction {
+  std::uint64_t       tick = 0;
+  std::string         name;
+  ActionState         state = START;
+  std::optional<Vec2> position;
+
+  /**
+   * The budget applied, for `SPAWN_BUDGET_ACTION` entries.
+   */
+  std::optional<MainSceneSimulation::SpawnBudget> spawnBudget;
+};
+
+/**
+ * The state a session ended in, used to check that a replay reproduced it.
+ */
+struct RecordingSummary {
+  std::uint64_t tickCount   = 0;
+  int           score       = 0;
+  int           lives       = 0;
+  std::uint64_t entityCount = 0;
+
+  bool operator==(const RecordingSummary &other) const = default;
+
+  static RecordingSummary capture(MainSceneSimulation &simulation);
+};
+
+/**
+ * Everything needed to reproduce a main scene session: the simulation seed, the tick length,
+ * the starting window size and the tick-stamped input stream.
+ *
+ * Window resizes are recorded as `WINDOW_RESIZE_ACTION` entries whose position holds the new
+ * window size, since the simulation reads the window bounds every tick. Spawn budget changes
+ * are recorded as `SPAWN_BUDGET_ACTION` entries carrying the budget.
+ */
+struct InputRecording {
+  static constexpr const char *WINDOW_RESIZE_ACTION = "WINDOW_RESIZE";
+  static constexpr const char *SPAWN_BUDGET_ACTION  = "SPAWN_BUDGET";
+
+  std::uint32_t               seed         = 0;
+  std::uint64_t               tickDuration = MainSceneSimulation::TICK_DURATION;
+  Vec2                        windowSize;
+  std::vector<RecordedAction> actions;
+  RecordingSummary            summary;
+
+  /**
+   * Serializes the recording. Action names are stored once in a table and actions are
+   * delta-encoded against the previous tick, so a session is typically a few bytes per
+   * input.
+   */
+  std::vector<std::uint8_t> serialize() const;
+
+  /**
+   * @throws BinaryFormatError if the data is not a recording or uses an unknown version.
+   */
+  static InputRecording deserialize(const std::vector<std::uint8_t> &bytes);
+
+  void                  save(const std::filesystem::path &path) const;
+  static InputRecording load(const std::filesystem::path &path);
+};
+
+/**
+ * Captures the inputs applied to a simulation so the session can be replayed later.
+ */
+class InputRecorder {
+  InputRecording m_recording;
+
+public:
+  InputRecorder(std::uint32_t seed, const Vec2 &windowSize);
+
+  /**
+   * Records an action that is about to be applied to the simulation at its current tick.
+   */
+  void record(const MainSceneSimulation &simulation, const Action &action);
+
+  /**
+   * Records a window resize that is about to be applied at the simulation's current tick.
+   */
+  void recordWindowResize(const MainSceneSimulation &simulation, const Vec2 &windowSize);
+
+  /**
+   * Records a spawn budget that is about to be applied at the simulation's current tick.
+   */
+  void recordSpawnBudget(const MainSceneSimulation              &simulation,
+                         const MainSceneSimulation::SpawnBudget &spawnBudget);
+
+  /**
+   * Drops the input recorded at or after `tick`, e.g. after the simulation has been rewound
+   * to the end of that tick.
+   */
+  void discardFrom(std::uint64_t tick);
+
+  /**
+   * The window size in effect after the last recorded resize, or the starting one.
+   */
+  Vec2 getWindowSize() const;
+
+  /**
+   * Stores the simulation's final state in the recording summary.
+   */
+  void finish(MainSceneSimulation &simulation);
+
+  const InputRecording &getRecording() const;
+};
+
+/**
+ * Feeds a recording back into a simulation, one tick at a time.
+ */
+class InputReplayer {
+public:
+  typedef std::function<void(MainSceneSimulation &simulation)> TickCallback;
+
+private:
+  const InputRecording &m_recording;
+  size_t                m_nextAction = 0;
+
+public:
+  explicit InputReplayer(const InputRecording &recording);
+
+  /**
+   * Applies the recorded inputs for the simulation's current tick, in order, up to the first
+   * window resize or spawn budget change. Call before each update.
+   *
+   * @returns Whether every action for the tick has been applied. If not, apply the pending
+   * changes with `applyConfigActions` and call this again before updating.
+   */
+  bool applyActions(MainSceneSimulation &simulation);
+
+  /**
+   * Applies the window resizes and spawn budget changes due next. Resizes write to the
+   * configuration, so call this only while nothing else reads it, e.g. on the main thread
+   * between frames.
+   */
+  void applyConfigActions(MainSceneSimulation &simulation, ConfigManager &configManager);
+
+  /**
+   * Whether the simulation has reached the tick the recorded session ended on.
+   */
+  bool isFinished(const MainSceneSimulation &simulation) const;
+
+  /**
+   * Continues the replay from `tick`, e.g. after the simulation has been rewound to the end of
+   * that tick.
+   */
+  void seek(std::uint64_t tick);
+
+  /**
+   * Replays the whole recording on a fresh simulation as fast as possible.
+   *
+   * @param onTick Called after every simulated tick, e.g. to hash or inspect the state.
+   * @returns The state the replay ended in, to compare against the recording's summary.
+   */
+  static RecordingSummary run(const InputRecording &recording,
+                              ConfigManager        &configManager,
+                              const TickCallback   &onTick = {});
+};
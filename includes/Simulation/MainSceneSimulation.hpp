@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../Configuration/ConfigManager.hpp"
+#include "../EntityManagement/EntityManager.hpp"
+#include "../GameEngine/Action.hpp"
+#include "../GameEngine/JobSystem.hpp"
+#include "../Helpers/BinaryIO.hpp"
+#include "./ExpiryTimers.hpp"
+#include "./GameEvent.hpp"
+#include "./MainSceneSpawner.hpp"
+#include "./SimulationRandom.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * The gameplay rules of the main scene, without any SDL dependency.
+ *
+ * The simulation owns its entities, random streams, spawner and clock. It is advanced by
+ * calling `update` with the elapsed time, so it can be driven by the SDL front-end in real
+ * time or stepped as fast as possible by batch runners and benchmarks.
+ */
+class MainSceneSimulation {
+public:
+  /**
+   * The fixed step, in milliseconds, that front-ends advance the simulation by. Stepping in
+   * whole ticks keeps a session reproducible from its seed and input stream alone.
+   */
+  static constexpr std::uint64_t TICK_DURATION = 16;
+
+  /**
+   * Work done by the systems during the latest tick, for telemetry. Not part of the gameplay
+   * state, so it is neither snapshotted nor hashed.
+   */
+  struct TickStats {
+    std::uint32_t collisionChecks = 0;
+    std::uint32_t collisions      = 0;
+    std::uint32_t spawnAttempts   = 0;
+    std::uint32_t spawns          = 0;
+    std::uint32_t culled          = 0;
+  };
+
+  /**
+   * Limits on spawning, set by a load controller to hold a frame time target. The budget
+   * changes what spawns, so it is part of the gameplay state and front-ends record every
+   * change alongside the input.
+   */
+  struct SpawnBudget {
+    /**
+     * Scales every spawn chance. At zero, spawn rounds are deferred until the budget rises.
+     */
+    std::uint8_t spawnPercentage = 100;
+
+    /**
+     * How many of the oldest low-value entities to destroy at the start of the next tick.
+     */
+    std::uint8_t cullCount = 0;
+
+    bool operator==(const SpawnBudget &other) const = default;
+  };
+
+private:
+  static constexpr int           STARTING_LIVES        = 5;
+  static constexpr std::uint64_t ROUND_DURATION        = 2.5 * 60 * 1000;
+  static constexpr std::uint64_t BULLET_SPAWN_COOLDOWN = 90;
+
+  ConfigManager          &m_configManager;
+  std::uint64_t           m_currentTime                  = 0;
+  std::uint64_t           m_tick                         = 0;
+  std::uint64_t           m_lastNonPlayerEntitySpawnTime = 0;
+  EntityManager           m_entities;
+  float                   m_deltaTime = 0;
+  int                     m_score     = 0;
+  int                     m_lives     = STARTING_LIVES;
+  std::shared_ptr<Entity> m_player;
+  std::uint64_t           m_timeRemaining = ROUND_DURATION;
+  bool                    m_gameOver      = false;
+  SimulationRandom        m_random;
+  std::uint64_t           m_lastBulletSpawnTime = 0;
+  std::uint64_t           m_bulletSpawnCooldown = BULLET_SPAWN_COOLDOWN;
+  ExpiryTimers            m_expiryTimers;
+  MainSceneSpawner        m_spawner;
+  std::vector<GameEvent>  m_events;
+  TickStats               m_tickStats;
+  SpawnBudget             m_spawnBudget;
+  JobSystem              *m_jobSystem = nullptr;
+
+  /**
+   * How many entities the constructor spawned: the player and the walls.
+   */
+  size_t m_initialEntityCount;
+
+  /**
+   * Destroys up to `count` entities, slowness debuffs first, then speed boosts, then enemies,
+   * oldest first within each.
+   */
+  void cullLowValueEntities(size_t count);
+
+public:
+  /**
+   * Creates the simulation and spawns the player and walls.
+   *
+   * @param configManager The configuration used for spawning and movement.
+   * @param seed The seed for the simulation's random streams.
+   */
+  MainSceneSimulation(ConfigManager &configManager, std::uint32_t seed);
+
+  /**
+   * Starts a new round with another seed, leaving the simulation as the constructor would.
+   *
+   * The player and walls are kept and put back as they were spawned, and every container
+   * keeps its storage, so a reset does not allocate. Only if the walls have been rebuilt for
+   * a resized window are the player and walls spawned again.
+   */
+  void reset(std::uint32_t seed);
+
+  /**
+   * Advances the simulation clock and runs every gameplay system once.
+   *
+   * Does nothing once the game is over.
+   *
+   * @param deltaTime The elapsed time in milliseconds since the previous update.
+   */
+  void update(std::uint64_t deltaTime);
+
+  /**
+   * Advances the simulation clock by one tick without running any system, for front-ends
+   * that run the systems themselves, such as the stress test.
+   */
+  void beginTick(std::uint64_t deltaTime);
+
+  /**
+   * Applies a player action (movement and shooting) to the simulation.
+   */
+  void sDoAction(const Action &action);
+
+  /**
+   * Rebuilds the walls for the current window size.
+   */
+  void onWindowResize();
+
+  /**
+   * Replaces the spawn budget. Any cull it requests runs at the start of the next update.
+   */
+  void setSpawnBudget(const SpawnBudget &spawnBudget);
+
+  /**
+   * Spawns entities with the tag at random positions, without the spawner's checks for
+   * overlaps, the player, spawn chances or the spawn budget. Used to build load test
+   * populations; see `MainSceneSpawner::spawnUnchecked` for the tags supported.
+   */
+  void spawnUnchecked(EntityTags tag, size_t count);
+
+  /**
+   * Destroys up to `count` of the oldest active entities with the tag.
+   *
+   * @returns The number of entities destroyed.
+   */
+  size_t destroyOldest(EntityTags tag, size_t count);
+
+  /**
+   * Spreads the per-entity work of the systems that only touch each entity's own components
+   * across the job system's threads. Without a job system, every system runs on the calling
+   * thread. Either way the results are identical, so this is not part of the gameplay state.
+   */
+  void setJobSystem(JobSystem *jobSystem);
+
+  /**
+   * Appends a versioned snapshot of the complete gameplay state: every entity and component,
+   * the random seed, score, lives, clock, timers and spawn budget. Pending events are not
+   * included.
+   */
+  void saveSnapshot(BinaryWriter &writer) const;
+
+  /**
+   * Replaces the gameplay state with a snapshot written by `saveSnapshot`. The configuration
+   * is not part of a snapshot; it should match the one the snapshot was taken with.
+   *
+   * @throws BinaryFormatError if the snapshot is malformed or of an unsupported version, in
+   * which case the simulation is left partially restored.
+   */
+  void restoreSnapshot(BinaryReader &reader);
+
+  void sCollision();
+  void sMovement();
+  void sSpawner();
+  void sLifespan();
+  void sEffects();
+  void sTimer(std::uint64_t deltaTime);
+
+  int  getScore() const;
+  void setScore(int score);
+  int  getLives() const;
+  void decrementLives();
+
+  void setGameOver();
+  bool isGameOver() const;
+
+  std::uint64_t                  getCurrentTime() const;
+  std::uint64_t                  getTick() const;
+  std::uint64_t                  getTimeRemaining() const;
+  EntityManager                 &getEntityManager();
+  const std::shared_ptr<Entity> &getPlayer() const;
+  const TickStats               &getTickStats() const;
+  const SpawnBudget             &getSpawnBudget() const;
+
+  /**
+   * Events raised since the last call to `clearEvents`. Whoever drives the simulation is
+   * responsible for clearing them once they have been handled.
+   */
+  const std::vector<GameEvent> &getEvents() const;
+  void                          clearEvents();
+};
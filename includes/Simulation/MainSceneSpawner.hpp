@@ -0,0 +1,54 @@
+#pragma once
+#include "../Configuration/ConfigManager.hpp"
+#include "../EntityManagement/EntityManager.hpp"
+#include "./ExpiryTimers.hpp"
+#include "./SimulationRandom.hpp"
+#include <cstdint>
+
+class MainSceneSpawner {
+  const SimulationRandom &m_random;
+  ConfigManager          &m_configManager;
+  EntityManager          &m_entityManager;
+  const std::uint64_t    &m_currentTime;
+  ExpiryTimers           &m_expiryTimers;
+
+  Vec2 getPlayerSpawnPosition() const;
+
+public:
+  MainSceneSpawner(const SimulationRandom &random,
+                   ConfigManager          &configManager,
+                   EntityManager          &entityManager,
+                   const std::uint64_t    &currentTime,
+                   ExpiryTimers           &expiryTimers);
+
+  std::shared_ptr<Entity> spawnPlayer();
+
+  /**
+   * Puts a player made by `spawnPlayer` back as it was spawned: centred, at rest, with no
+   * input held and no effects.
+   */
+  void resetPlayer(const std::shared_ptr<Entity> &player) const;
+
+  /**
+   * The spawn functions for non-player entities try a limited number of random positions
+   * away from the player and return whether one was free; otherwise nothing is spawned.
+   * Positions and velocities are drawn from the new entity's own placement stream.
+   */
+  bool spawnEnemy(const std::shared_ptr<Entity> &player);
+  bool spawnSpeedBoostEntity(const std::shared_ptr<Entity> &player);
+  bool spawnSlownessEntity(const std::shared_ptr<Entity> &player);
+  bool spawnItem(const std::shared_ptr<Entity> &player);
+
+  /**
+   * Spawns an enemy, bullet, item, speed boost or slowness debuff with the usual components
+   * at a random position within the window, without checking for overlaps or the player.
+   * Bullets head in a random direction. The entity is pending until the entity manager's next
+   * update. Other tags spawn nothing.
+   *
+   * @returns The new entity, or nullptr for a tag that cannot be spawned this way.
+   */
+  std::shared_ptr<Entity> spawnUnchecked(EntityTags tag);
+
+  void spawnWalls();
+  void spawnBullets(const std::shared_ptr<Entity> &player, const Vec2 &mousePosition);
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "../Configuration/ConfigManager.hpp"
+#include "../GameEngine/JobSystem.hpp"
+#include "../Helpers/Vec2.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * Owns N independent main scene simulations and steps them in lockstep.
+ *
+ * Every environment has its own EntityManager, random streams and spawner. A call to
+ * `step` applies one action per environment, advances every simulation by a fixed time step
+ * and writes observations, rewards and done flags into buffers that are allocated once up
+ * front. The environments are stepped by a `JobSystem::ParallelLoop` on the runner's own job
+ * system, whose helper jobs are also created once, so the stepping itself does not allocate;
+ * only what the simulations do within a tick may.
+ *
+ * Environments that finish an episode report `done` once and are reset in place with a new
+ * seed at the start of the following step, so starting an episode does not allocate either.
+ */
+class MultiEnvironmentRunner {
+public:
+  /**
+   * Layout of the per-environment observation vector.
+   */
+  enum ObservationIndex : size_t {
+    PLAYER_X,
+    PLAYER_Y,
+    PLAYER_VELOCITY_X,
+    PLAYER_VELOCITY_Y,
+    SCORE,
+    LIVES,
+    TIME_REMAINING,
+    SPEED_EFFECT_ACTIVE,
+    SLOWNESS_EFFECT_ACTIVE,
+    ENEMY_COUNT,
+    BULLET_COUNT,
+    ITEM_COUNT,
+    SPEED_BOOST_COUNT,
+    SLOWNESS_DEBUFF_COUNT,
+    OBSERVATION_SIZE
+  };
+
+  struct EnvironmentAction {
+    bool forward  = false;
+    bool backward = false;
+    bool left     = false;
+    bool right    = false;
+    bool shoot    = false;
+    Vec2 target;
+  };
+
+private:
+  ConfigManager                                    &m_configManager;
+  std::vector<std::unique_ptr<MainSceneSimulation>> m_environments;
+  std::vector<float>                                m_observations;
+  std::vector<float>                                m_rewards;
+  std::vector<std::uint8_t>                         m_dones;
+  std::vector<int>                                  m_lastScores;
+  std::vector<std::uint64_t>                        m_episodeCounts;
+  std::uint32_t                                     m_seed;
+  std::uint64_t                                     m_stepDuration;
+  JobSystem                                         m_jobSystem;
+  JobSystem::ParallelLoop                           m_stepLoop;
+  const EnvironmentAction                          *m_actions = nullptr;
+
+  void          resetEnvironment(size_t index);
+  void          stepRange(size_t begin, size_t end);
+  void          writeObservation(size_t index);
+  std::uint32_t createSeed(size_t index) const;
+
+public:
+  /**
+   * @param configManager Configuration shared (read-only) by every environment.
+   * @param environmentCount The number of simulations to run.
+   * @param seed Base seed; each environment and episode derives its own seed from it.
+   * @param threadCount Total threads stepping environments, including the caller's.
+   * @param stepDuration The simulated time, in milliseconds, of a single step.
+   */
+  MultiEnvironmentRunner(ConfigManager &configManager,
+                         size_t         environmentCount,
+                         std::uint32_t  seed,
+                         size_t         threadCount  = std::thread::hardware_concurrency(),
+                         std::uint64_t  stepDuration = MainSceneSimulation::TICK_DURATION);
+
+  MultiEnvironmentRunner(const MultiEnvironmentRunner &)            = delete;
+  MultiEnvironmentRunner &operator=(const MultiEnvironmentRunner &) = delete;
+
+  /**
+   * Restarts every environment and refreshes the observation buffer.
+   */
+  void reset();
+
+  /**
+   * Applies one action per environment and advances all of them by one step.
+   *
+   * @param actions An array of `getEnvironmentCount()` actions, or nullptr for no input.
+   */
+  void step(const EnvironmentAction *actions);
+
+  size_t getEnvironmentCount() const;
+  size_t getThreadCount() const;
+
+  /**
+   * Row-major `[environment][OBSERVATION_SIZE]` observation buffer.
+   */
+  const float *getObservations() const;
+
+  /**
+   * Score gained during the last step, per environment.
+   */
+  const float *getRewards() const;
+
+  /**
+   * 1 for environments whose episode ended during the last step, 0 otherwise.
+   */
+  const std::uint8_t *getDones() const;
+
+  MainSceneSimulation &getEnvironment(size_t index);
+};
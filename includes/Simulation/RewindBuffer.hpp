@@ -0,0 +1,83 @@
+#pragma once
+
+#include "../Helpers/BinaryIO.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+/**
+ * A flight recorder for the main scene simulation: a ring buffer of recent ticks that the
+ * simulation can be rewound to.
+ *
+ * Every `keyframeInterval` ticks a full snapshot is stored. The ticks in between are stored
+ * as deltas against the previous tick's snapshot: the two snapshots are XORed and encoded as
+ * varint runs of unchanged bytes and the changed bytes, so a tick only costs roughly the
+ * components that changed. Whole keyframe segments are evicted, oldest first, to stay within
+ * the memory budget.
+ */
+class RewindBuffer {
+  struct Segment {
+    std::uint64_t             firstTick = 0;
+    std::vector<std::uint8_t> keyframe;
+    std::vector<std::uint8_t> deltas;
+    std::vector<size_t>       deltaOffsets;
+
+    std::uint64_t getLastTick() const;
+    size_t        getMemoryUsage() const;
+  };
+
+  size_t                       m_memoryBudget;
+  std::uint64_t                m_keyframeInterval;
+  std::deque<Segment>          m_segments;
+  size_t                       m_memoryUsage = 0;
+  BinaryWriter                 m_writer;
+  std::vector<std::uint8_t>    m_previousSnapshot;
+  std::optional<std::uint64_t> m_previousTick;
+
+  void discardAfter(std::uint64_t tick);
+  void enforceMemoryBudget();
+
+  static void encodeDelta(const std::vector<std::uint8_t> &previous,
+                          const std::vector<std::uint8_t> &current,
+                          std::vector<std::uint8_t>       &output);
+  static void decodeDelta(const std::uint8_t        *delta,
+                          size_t                     size,
+                          std::vector<std::uint8_t> &snapshot);
+
+public:
+  /**
+   * @param memoryBudget The maximum number of bytes of snapshot data to keep. The newest
+   * keyframe segment is always kept, even if it alone exceeds the budget.
+   * @param keyframeInterval The number of ticks between full snapshots.
+   */
+  RewindBuffer(size_t memoryBudget, std::uint64_t keyframeInterval);
+
+  /**
+   * Stores the simulation's state after its latest tick. Recording a tick that is not newer
+   * than the last recorded one, e.g. after a seek, discards the ticks after it first.
+   */
+  void record(const MainSceneSimulation &simulation);
+
+  /**
+   * Restores the simulation to the state it was in after `tick`.
+   *
+   * @returns false, leaving the simulation untouched, if the tick is not in the buffer.
+   */
+  bool seek(MainSceneSimulation &simulation, std::uint64_t tick);
+
+  /**
+   * Restores the simulation `ticks` ticks back, or to the oldest buffered tick if fewer are
+   * buffered.
+   *
+   * @returns false if nothing older than the current tick is buffered.
+   */
+  bool stepBack(MainSceneSimulation &simulation, std::uint64_t ticks = 1);
+
+  std::optional<std::uint64_t> getOldestTick() const;
+  std::optional<std::uint64_t> getNewestTick() const;
+  size_t                       getMemoryUsage() const;
+  void                         clear();
+};
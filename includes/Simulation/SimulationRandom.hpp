@@ -0,0 +1,41 @@
+#pragma once
+
+#include "../Helpers/RandomStream.hpp"
+
+#include <cstdint>
+
+/**
+ * The systems that draw random numbers, each from its own streams.
+ */
+enum class RandomStreamId : std::uint32_t {
+  SPAWN_ROLLS,
+  SPAWN_PLACEMENT,
+  EFFECT_DURATION,
+};
+
+/**
+ * The simulation's source of randomness. It holds no generator state: every draw comes from a
+ * `RandomStream` named by the seed, the system, the current tick and a subject, usually the
+ * id of the entity the numbers are for. A system's results therefore depend only on what it
+ * is drawing for, not on which other systems or entities drew before it, so they stay the
+ * same when work is reordered or spread across threads.
+ */
+class SimulationRandom {
+  std::uint32_t        m_seed;
+  const std::uint64_t &m_tick;
+
+public:
+  /**
+   * @param tick The simulation's tick counter, read whenever a stream is created.
+   */
+  SimulationRandom(std::uint32_t seed, const std::uint64_t &tick);
+
+  /**
+   * The stream for a system and subject at the current tick. Streams for the same arguments
+   * within a tick produce the same numbers, so each subject should create its stream once.
+   */
+  RandomStream getStream(RandomStreamId streamId, std::uint64_t subject = 0) const;
+
+  std::uint32_t getSeed() const;
+  void          setSeed(std::uint32_t seed);
+};
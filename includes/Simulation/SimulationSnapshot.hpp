@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../EntityManagement/EntityManager.hpp"
+#include "../Helpers/BinaryIO.hpp"
+
+#include <cstdint>
+
+/**
+ * Versioned binary encoding of simulation state.
+ *
+ * Entities are written by id together with every component they carry, so a snapshot holds no
+ * pointers and can be restored into any simulation, e.g. to fork one run into many branches.
+ * A shape is written as its size only: where it is drawn follows from the entity's transform.
+ */
+namespace SimulationSnapshot {
+  constexpr std::uint32_t MAGIC   = 0x53425259; // "YRBS"
+  constexpr std::uint16_t VERSION = 4;
+
+  /**
+   * Writes every live and pending entity of the manager, in order.
+   */
+  void writeEntities(BinaryWriter &writer, const EntityManager &entityManager);
+
+  /**
+   * Replaces the contents of the manager with the entities read from a snapshot.
+   *
+   * @throws BinaryFormatError if the data is truncated or malformed.
+   */
+  void readEntities(BinaryReader &reader, EntityManager &entityManager);
+
+  void writeHeader(BinaryWriter &writer);
+
+  /**
+   * @throws BinaryFormatError if the data is not a snapshot of a supported version.
+   */
+  void readHeader(BinaryReader &reader);
+} // namespace SimulationSnapshot
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../Configuration/Config.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <cstdint>
+#include <optional>
+
+/**
+ * Sheds load to hold the simulation and render work of a frame under a target.
+ *
+ * Front-ends report how long each frame's simulation and render work took. The controller
+ * smooths it and, every few frames, lowers the spawn percentage while the work is over target
+ * and raises it again once there is headroom. When spawning is already deferred and the work
+ * is still well over target, it also asks for the oldest low-value entities to be culled.
+ *
+ * The controller reads wall clock measurements, so its decisions are not reproducible. They
+ * are applied with `MainSceneSimulation::setSpawnBudget`, which front-ends record like input.
+ */
+class SpawnBudgetController {
+public:
+  /**
+   * What the controller has measured and decided so far, for logging and overlays.
+   */
+  struct Metrics {
+    /**
+     * The smoothed simulation and render work per frame, in milliseconds.
+     */
+    float         frameCost       = 0;
+    std::uint8_t  spawnPercentage = 100;
+    std::uint64_t throttledFrames = 0;
+    std::uint64_t culledEntities  = 0;
+  };
+
+private:
+  SpawnBudgetConfig m_config;
+  Metrics           m_metrics;
+  std::uint64_t     m_frameCount = 0;
+
+  /**
+   * How many live entities the controller may ask to cull: every enemy, speed boost and
+   * slowness debuff.
+   */
+  static size_t countCullable(EntityManager &entityManager);
+
+public:
+  explicit SpawnBudgetController(const SpawnBudgetConfig &config);
+
+  /**
+   * Feeds the controller one frame's measured work.
+   *
+   * @param frameCost The time this frame's simulation and render work took, in milliseconds,
+   * not counting the wait to present it. Work that ran in parallel counts once, from the
+   * start of the first part to the end of the last.
+   * @returns The budget to apply before the next update, on the frames the controller
+   * adjusts it. Nothing is returned while the controller is disabled.
+   */
+  std::optional<MainSceneSimulation::SpawnBudget>
+  update(float frameCost, EntityManager &entityManager);
+
+  /**
+   * Whether spawning is currently throttled below the configured chances.
+   */
+  bool isSheddingLoad() const;
+
+  const Metrics &getMetrics() const;
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../EntityManagement/Entity.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Maintains a 64-bit hash of the gameplay state of a simulation from tick to tick.
+ *
+ * The state hash combines the global counters (score, lives, clock, timer) with the sum of
+ * per-entity hashes covering transforms, velocities, lifespans, effects and bounces.
+ *
+ * This is a full rehash: every update hashes every live entity from its components again.
+ * The systems mutate components in place without reporting it, and nearly every entity
+ * moves every tick anyway. The previous tick's entity hashes are cached only to find the
+ * entities whose hash changed, appeared or disappeared, which are reported for the log.
+ */
+class StateHasher {
+public:
+  typedef std::pair<size_t, std::uint64_t> EntityHashChange;
+
+  /**
+   * Written in place of an entity hash when the entity was removed.
+   */
+  static constexpr std::uint64_t REMOVED_ENTITY_HASH = 0;
+
+private:
+  struct CachedEntityHash {
+    std::uint64_t hash     = 0;
+    std::uint64_t seenTick = 0;
+  };
+
+  std::unordered_map<size_t, CachedEntityHash> m_entityHashes;
+  std::vector<EntityHashChange>                m_changes;
+  std::uint64_t                                m_entitySum  = 0;
+  std::uint64_t                                m_globalHash = 0;
+  std::uint64_t                                m_stateHash  = 0;
+  std::uint64_t                                m_updates    = 0;
+
+public:
+  /**
+   * Folds the simulation's state after its latest tick into the hash.
+   *
+   * @returns The new state hash.
+   */
+  std::uint64_t update(MainSceneSimulation &simulation);
+
+  std::uint64_t getStateHash() const;
+  std::uint64_t getGlobalHash() const;
+
+  /**
+   * The entities whose hash changed during the last update, with `REMOVED_ENTITY_HASH` for
+   * entities that no longer exist.
+   */
+  const std::vector<EntityHashChange> &getChanges() const;
+
+  static std::uint64_t hashEntity(const Entity &entity);
+};
+
+/**
+ * Streams the per-tick hashes and entity hash changes of a run to a side file.
+ */
+class StateHashLogWriter {
+  std::ofstream m_file;
+
+public:
+  /**
+   * @throws BinaryFormatError if the file cannot be opened.
+   */
+  explicit StateHashLogWriter(const std::filesystem::path &path);
+
+  void write(std::uint64_t tick, const StateHasher &hasher);
+};
+
+/**
+ * The first point at which two state hash logs disagree.
+ */
+struct StateHashDivergence {
+  std::uint64_t       tick               = 0;
+  bool                globalStateDiffers = false;
+  bool                runLengthDiffers   = false;
+  std::vector<size_t> entityIds;
+};
+
+namespace StateHashHelpers {
+  /**
+   * Compares two state hash logs tick by tick.
+   *
+   * @throws BinaryFormatError if either file is not a state hash log.
+   * @returns The first divergent tick, or nothing if the runs are identical.
+   */
+  std::optional<StateHashDivergence> findFirstDivergence(const std::filesystem::path &first,
+                                                         const std::filesystem::path &second);
+} // namespace StateHashHelpers
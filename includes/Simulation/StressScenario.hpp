@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../Configuration/Config.hpp"
+#include "../Helpers/FrameTimeHistogram.hpp"
+#include "./MainSceneSimulation.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+/**
+ * The work a stress test frame is split into, in the order it runs.
+ */
+enum class StressSystem : std::uint8_t {
+  POPULATION,
+  MOVEMENT,
+  COLLISION,
+  LIFESPAN,
+  EFFECTS,
+  RENDER,
+};
+
+constexpr size_t STRESS_SYSTEM_COUNT = static_cast<size_t>(StressSystem::RENDER) + 1;
+
+/**
+ * What one stress test frame measured. Durations are in microseconds.
+ */
+struct StressFrameSample {
+  std::array<std::uint32_t, STRESS_SYSTEM_COUNT> systemTimes{};
+  std::uint32_t                                  frameTime   = 0;
+  size_t                                         entityCount = 0;
+};
+
+/**
+ * Drives a stress test through its configured stages and measures how the cost of each
+ * system scales with the population.
+ *
+ * Every stage ramps the population of each tag linearly from the previous stage's (nothing,
+ * for the first) to its own, then holds it. Front-ends apply the target population before
+ * running the systems each frame and report what the frame measured; only the frames a stage
+ * holds its population for count towards its results.
+ */
+class StressScenario {
+public:
+  struct StageResult {
+    StressPopulation                               population;
+    FrameTimeHistogram                             frameTimes;
+    std::array<std::uint64_t, STRESS_SYSTEM_COUNT> totalSystemTimes{};
+    std::uint64_t                                  totalEntityCount = 0;
+
+    double getMeanSystemTime(StressSystem system) const;
+    double getMeanEntityCount() const;
+  };
+
+private:
+  std::vector<StressStageConfig> m_stages;
+  std::vector<StageResult>       m_results;
+  StressPopulation               m_rampStart;
+  size_t                         m_stageIndex = 0;
+  std::uint64_t                  m_stageFrame = 0;
+
+public:
+  /**
+   * @param frameTimeTarget The intended frame duration, in microseconds. Frames longer than
+   * twice the target count as hitches.
+   */
+  StressScenario(const StressConfig &config, std::uint32_t frameTimeTarget);
+
+  /**
+   * The population the current frame should run with.
+   */
+  StressPopulation getTargetPopulation() const;
+
+  /**
+   * Spawns or destroys the oldest entities of each tag until the simulation holds the target
+   * population. Entities the systems destroyed since the last frame are replaced.
+   */
+  void applyTargetPopulation(MainSceneSimulation &simulation) const;
+
+  /**
+   * Records a frame against the current stage and advances to the next frame.
+   */
+  void recordFrame(const StressFrameSample &sample);
+
+  bool   isFinished() const;
+  bool   isRamping() const;
+  size_t getStageIndex() const;
+  size_t getStageCount() const;
+
+  const std::vector<StageResult> &getResults() const;
+
+  /**
+   * Writes the results of every stage: its target population, the mean entity count, the
+   * mean time per frame of each system, the frame time p50, p99, maximum and hitch count,
+   * and how each system's time scaled from the previous stage. Times are in microseconds.
+   * Written as CSV when the path ends in `.csv` and as JSON otherwise.
+   *
+   * The scaling exponent k of a system fits t ∝ n^k between two stages, where n is the mean
+   * entity count: 1 means the system scales linearly, 2 quadratically.
+   *
+   * @throws std::runtime_error if the file cannot be written.
+   */
+  void saveReport(const std::filesystem::path &path) const;
+};
+
+namespace StressHelpers {
+  std::string_view getSystemName(StressSystem system);
+
+  /**
+   * How many entities with the tag the population holds. Zero for tags a stress test does
+   * not spawn.
+   */
+  size_t getTagCount(const StressPopulation &population, EntityTags tag);
+} // namespace StressHelpers
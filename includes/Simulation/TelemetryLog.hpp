@@ -0,0 +1,148 @@
+#pragma once
+
+#include "./MainSceneSimulation.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+/**
+ * The per-tick counters stored in a telemetry log, in file order.
+ */
+enum class TelemetryColumn : std::uint16_t {
+  TICK,
+  FRAME_TIME_US,
+  UPDATE_TIME_US,
+  ENTITY_COUNT,
+  ENEMY_COUNT,
+  BULLET_COUNT,
+  ITEM_COUNT,
+  SPEED_BOOST_COUNT,
+  SLOWNESS_DEBUFF_COUNT,
+  COLLISION_CHECKS,
+  COLLISIONS,
+  SPAWN_ATTEMPTS,
+  SPAWNS,
+  SPAWN_PERCENTAGE,
+  CULLED,
+  SCORE,
+};
+
+constexpr size_t TELEMETRY_COLUMN_COUNT = static_cast<size_t>(TelemetryColumn::SCORE) + 1;
+
+/**
+ * One tick's worth of telemetry.
+ */
+struct TelemetryRow {
+  std::array<std::uint32_t, TELEMETRY_COLUMN_COUNT> values{};
+
+  std::uint32_t &operator[](TelemetryColumn column);
+
+  /**
+   * Reads the entity populations and the system counters of the simulation's latest tick.
+   *
+   * @param frameTime The duration of the frame that ran the tick, in microseconds.
+   * @param updateTime The time spent in the simulation's update, in microseconds.
+   */
+  static TelemetryRow
+  capture(MainSceneSimulation &simulation, std::uint32_t frameTime, std::uint32_t updateTime);
+};
+
+/**
+ * Streams telemetry rows to a columnar log file.
+ *
+ * The file starts with a header listing the column names and the block size, followed by
+ * fixed-size blocks. Each block holds up to `rowsPerBlock` rows stored column by column as
+ * little-endian 32-bit values, so a column can be scanned in place without parsing.
+ *
+ * Rows are appended to an in-memory block; full blocks are handed to a background thread
+ * that writes them out, so `write` never waits on the disk. Buffers are recycled between the
+ * two threads, so steady-state logging does not allocate.
+ */
+class TelemetryLogWriter {
+  std::ofstream                           m_file;
+  size_t                                  m_rowsPerBlock;
+  std::vector<std::uint32_t>              m_block;
+  size_t                                  m_rowCount = 0;
+  std::vector<std::vector<std::uint32_t>> m_pendingBlocks;
+  std::vector<std::vector<std::uint32_t>> m_freeBlocks;
+  std::mutex                              m_mutex;
+  std::condition_variable                 m_blocksPending;
+  bool                                    m_stopping = false;
+  std::thread                             m_flushThread;
+
+  void flushBlock();
+  void flushLoop();
+
+public:
+  static constexpr std::uint32_t MAGIC   = 0x54425259; // "YRBT"
+  static constexpr std::uint16_t VERSION = 1;
+
+  /**
+   * @param rowsPerBlock Rows per block; rounded up to an even number so blocks stay 8-byte
+   * aligned.
+   * @throws BinaryFormatError if the file cannot be opened.
+   */
+  explicit TelemetryLogWriter(const std::filesystem::path &path, size_t rowsPerBlock = 1024);
+
+  /**
+   * Writes out the last, partially filled block and waits for the flush thread to finish.
+   */
+  ~TelemetryLogWriter();
+
+  TelemetryLogWriter(const TelemetryLogWriter &)            = delete;
+  TelemetryLogWriter &operator=(const TelemetryLogWriter &) = delete;
+
+  void write(const TelemetryRow &row);
+};
+
+/**
+ * Memory-maps a telemetry log for reading. Columns are exposed as spans into the mapping, one
+ * per block, so scanning a column touches only that column's pages.
+ */
+class TelemetryLogReader {
+  const std::uint8_t      *m_data = nullptr;
+  size_t                   m_size = 0;
+  size_t                   m_rowsPerBlock;
+  size_t                   m_blockSize;
+  size_t                   m_blockCount;
+  size_t                   m_dataOffset;
+  std::vector<std::string> m_columnNames;
+
+public:
+  /**
+   * @throws BinaryFormatError if the file cannot be mapped or is not a telemetry log.
+   */
+  explicit TelemetryLogReader(const std::filesystem::path &path);
+  ~TelemetryLogReader();
+
+  TelemetryLogReader(const TelemetryLogReader &)            = delete;
+  TelemetryLogReader &operator=(const TelemetryLogReader &) = delete;
+
+  size_t                          getBlockCount() const;
+  size_t                          getRowCount() const;
+  const std::vector<std::string> &getColumnNames() const;
+
+  /**
+   * The values of one column within one block.
+   */
+  std::span<const std::uint32_t> getColumn(size_t block, size_t column) const;
+
+  /**
+   * The index of the column with the given name, or `getColumnNames().size()` if the log has
+   * no such column.
+   */
+  size_t findColumn(std::string_view name) const;
+};
+
+namespace TelemetryHelpers {
+  std::string_view getColumnName(TelemetryColumn column);
+} // namespace TelemetryHelpers
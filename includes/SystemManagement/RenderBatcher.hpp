@@ -0,0 +1,74 @@
+#pragma once
+
+#include "./SoftwareRenderer.hpp"
+#include <SDL2/SDL.h>
+#include <vector>
+
+/**
+ * Collects quads into vertex buffers and draws them with one `SDL_RenderGeometry` call per
+ * texture and blend mode, instead of a colour change and a draw call per quad. Each quad's
+ * colour, alpha included, is carried by its vertices; textured quads are modulated by it.
+ *
+ * Groups are drawn in the order their texture and blend mode were first added, so a quad
+ * may end up drawn under one added before it in another group. Within a group, quads keep
+ * the order they were added in. Buffers are kept between frames, so batching a steady
+ * number of quads does not allocate.
+ *
+ * With the software render backend, batches are handed to it instead of the SDL renderer.
+ */
+class RenderBatcher {
+  struct Batch {
+    SDL_Texture            *texture;
+    SDL_BlendMode           blendMode;
+    std::vector<SDL_Vertex> vertices = {};
+    std::vector<int>        indices  = {};
+  };
+
+  std::vector<Batch> m_batches;
+  size_t             m_drawCallCount = 0;
+  SoftwareRenderer  *m_softwareRenderer;
+
+  Batch &getBatch(SDL_Texture *texture, SDL_BlendMode blendMode);
+
+  static void drawBatch(SDL_Renderer *renderer, const Batch &batch);
+
+public:
+  /**
+   * @param softwareRenderer The software render backend to draw with, or nullptr to draw
+   * with the SDL renderer.
+   */
+  explicit RenderBatcher(SoftwareRenderer *softwareRenderer = nullptr);
+
+  /**
+   * @param texture The texture to stretch over the quad, or nullptr for a solid colour.
+   * @param texCoords The part of the texture to draw, in normalized texture coordinates.
+   */
+  void addQuad(const SDL_Rect  &rect,
+               SDL_Color        color,
+               SDL_Texture     *texture   = nullptr,
+               const SDL_FRect &texCoords = {.x = 0, .y = 0, .w = 1, .h = 1},
+               SDL_BlendMode    blendMode = SDL_BLENDMODE_BLEND);
+
+  /**
+   * Adds quads whose vertices are already laid out as `addQuad` lays them out, four
+   * vertices per quad, copying them in one go.
+   *
+   * @param texture The texture stretched over the quads, or nullptr for solid colours.
+   */
+  void addQuads(const SDL_Vertex *vertices,
+                size_t            quadCount,
+                SDL_Texture      *texture   = nullptr,
+                SDL_BlendMode     blendMode = SDL_BLENDMODE_BLEND);
+
+  /**
+   * Draws the quads added since the last flush and empties the batches. The renderer's draw
+   * blend mode is left as the last solid colour batch set it. With the software render
+   * backend `renderer` is unused and may be nullptr.
+   */
+  void flush(SDL_Renderer *renderer);
+
+  /**
+   * The number of draw calls the last flush issued.
+   */
+  size_t getDrawCallCount() const;
+};
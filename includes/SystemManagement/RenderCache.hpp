@@ -0,0 +1,53 @@
+#pragma once
+
+#include "./SoftwareRenderer.hpp"
+#include <SDL2/SDL.h>
+#include <functional>
+
+/**
+ * A frame drawn once into a render target texture and copied to the screen until it is
+ * invalidated.
+ *
+ * Scenes whose content only changes on input draw through the cache and invalidate it when
+ * their content changes; every other frame is a single texture copy. The cache also redraws
+ * when the renderer's output size changes. Renderers without render target support fall
+ * back to drawing every frame, as does the software render backend, which does not draw
+ * through the renderer.
+ */
+class RenderCache {
+  SDL_Renderer *m_renderer;
+  SDL_Texture  *m_texture = nullptr;
+  int           m_width   = 0;
+  int           m_height  = 0;
+  bool          m_valid   = false;
+  bool          m_enabled;
+
+  void destroyTexture();
+
+  /**
+   * Recreates the texture at the given size. Leaves it null if the renderer cannot render to
+   * textures or the texture cannot be created, after logging why.
+   */
+  void createTexture(int width, int height);
+
+public:
+  /**
+   * @param softwareRenderer The software render backend, if it is in use.
+   */
+  RenderCache(SDL_Renderer *renderer, const SoftwareRenderer *softwareRenderer);
+  ~RenderCache();
+
+  RenderCache(const RenderCache &)            = delete;
+  RenderCache &operator=(const RenderCache &) = delete;
+
+  /**
+   * Redraws the frame on the next render.
+   */
+  void invalidate();
+
+  /**
+   * Copies the cached frame to the screen, first drawing it with `draw` if it was invalidated
+   * or the output size changed. `draw` must fill the whole frame and flush any queued text.
+   */
+  void render(const std::function<void()> &draw);
+};
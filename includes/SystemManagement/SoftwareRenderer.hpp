@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../GameEngine/JobSystem.hpp"
+#include "../Helpers/SoftwareRasterizer.hpp"
+#include <SDL2/SDL.h>
+#include <unordered_map>
+
+/**
+ * The software render backend, for hosts without a GPU, where SDL falls back to its generic
+ * software renderer: the engine's batched quads and glyphs are drawn with a
+ * SoftwareRasterizer, and the SDL renderer only uploads and copies the finished frame
+ * through a streaming texture.
+ *
+ * SDL cannot read a texture's pixels back, so textures drawn through the backend are
+ * registered with the surface they were created from. Without a renderer, frames are drawn
+ * into memory only, for headless runs.
+ */
+class SoftwareRenderer {
+  SDL_Renderer                                                      *m_renderer;
+  SDL_Texture                                                       *m_frameTexture = nullptr;
+  SoftwareRasterizer                                                 m_rasterizer;
+  std::unordered_map<const SDL_Texture *, SoftwareRasterizer::Image> m_images;
+
+  void destroyFrameTexture();
+
+public:
+  /**
+   * @param renderer The renderer frames are presented with, or nullptr to only draw them
+   * into memory.
+   */
+  SoftwareRenderer(SDL_Renderer *renderer, JobSystem &jobSystem);
+  ~SoftwareRenderer();
+
+  SoftwareRenderer(const SoftwareRenderer &)            = delete;
+  SoftwareRenderer &operator=(const SoftwareRenderer &) = delete;
+
+  /**
+   * Keeps a copy of the pixels a texture was created from to draw it with. Textures that
+   * were not registered are skipped when drawn.
+   */
+  void registerTexture(const SDL_Texture *texture, SDL_Surface *surface);
+
+  /**
+   * Sets the size of the frame drawn without a renderer. With one, the frame follows the
+   * renderer's output size.
+   */
+  void resize(int width, int height);
+
+  /**
+   * Starts a frame by clearing it to the colour.
+   */
+  void clear(SDL_Color color);
+
+  /**
+   * Queues geometry laid out as RenderBatcher lays it out, every four vertices an
+   * axis-aligned quad from its top left to its bottom right corner. Blend modes other than
+   * `SDL_BLENDMODE_NONE` are drawn as `SDL_BLENDMODE_BLEND`.
+   */
+  void renderGeometry(SDL_Texture      *texture,
+                      const SDL_Vertex *vertices,
+                      int               vertexCount,
+                      SDL_BlendMode     blendMode);
+
+  /**
+   * Draws the queued geometry into the frame.
+   */
+  void flush();
+
+  /**
+   * Draws any geometry queued since the last flush and, with a renderer, uploads the frame
+   * and presents it.
+   */
+  void present();
+
+  const SoftwareRasterizer &getRasterizer() const;
+};
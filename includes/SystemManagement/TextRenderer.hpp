@@ -0,0 +1,54 @@
+#pragma once
+
+#include "../AssetManagement/FontManager.hpp"
+#include "../AssetManagement/GlyphAtlas.hpp"
+#include "../Helpers/Vec2.hpp"
+#include "./RenderBatcher.hpp"
+#include "./SoftwareRenderer.hpp"
+#include <SDL2/SDL.h>
+#include <SDL_ttf.h>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Draws lines of text from glyph atlases built once for every font of the FontManager.
+ *
+ * Lines are laid out from the atlases' cached glyph metrics and kerning and queued as
+ * textured quads, their colour carried by the vertices. Queued text is drawn on `flush`, with
+ * a single draw call per font, so scenes flush once all their text is queued and before
+ * presenting. Once the batches have grown to a frame's worth of text, laying out and drawing
+ * it does not allocate.
+ *
+ * Characters outside printable ASCII are skipped.
+ */
+class TextRenderer {
+  SDL_Renderer                                                     *m_renderer;
+  std::unordered_map<const TTF_Font *, std::unique_ptr<GlyphAtlas>> m_atlases;
+  RenderBatcher                                                     m_batcher;
+
+  const GlyphAtlas *getAtlas(const TTF_Font *font) const;
+
+public:
+  /**
+   * @param softwareRenderer The software render backend to draw with, or nullptr to draw
+   * with the SDL renderer.
+   * @throws std::runtime_error if a font's glyph atlas cannot be built.
+   */
+  TextRenderer(SDL_Renderer      *renderer,
+               const FontManager &fontManager,
+               SoftwareRenderer  *softwareRenderer = nullptr);
+
+  /**
+   * Queues a line of text with its top left corner at the position.
+   */
+  void renderLine(const TTF_Font  *font,
+                  std::string_view text,
+                  const SDL_Color &color,
+                  const Vec2      &position);
+
+  /**
+   * Draws the text queued since the last flush.
+   */
+  void flush();
+};
@@ -1,11 +1,15 @@
 #pragma once
 #include "../Configuration/ConfigManager.hpp"
+#include "../GameEngine/JobSystem.hpp"
 #include "../Helpers/Vec2.hpp"
+#include "./SoftwareRenderer.hpp"
 #include <SDL2/SDL.h>
+#include <memory>
 
 class VideoManager {
-  SDL_Renderer *m_renderer = nullptr;
-  SDL_Window   *m_window   = nullptr;
+  SDL_Renderer                     *m_renderer = nullptr;
+  SDL_Window                       *m_window   = nullptr;
+  std::unique_ptr<SoftwareRenderer> m_softwareRenderer;
 
   Vec2           m_currentWindowSize;
   ConfigManager &m_configManager;
@@ -63,11 +67,12 @@ public:
    * @brief Constructor method for the VideoManager.
    *
    * This initializes the VideoManager object by initializing SDL_VIDEO and by creating an
-   * SDL_Window and SDL_Renderer.
+   * SDL_Window and SDL_Renderer, and the software render backend when it is configured.
    *
    * @param configManager The ConfigManager object associated with the GameEngine class.
+   * @param jobSystem The job system the software render backend draws tiles on.
    */
-  explicit VideoManager(ConfigManager &configManager);
+  VideoManager(ConfigManager &configManager, JobSystem &jobSystem);
 
   /**
    * @brief Destructor for the VideoManager.
@@ -99,6 +104,29 @@ public:
    */
   SDL_Window *getWindow() const;
 
+  /**
+   * The software render backend, or nullptr when the SDL renderer draws the frames.
+   */
+  SoftwareRenderer *getSoftwareRenderer() const;
+
+  /**
+   * Starts a frame by clearing it to the colour, on whichever backend draws the frames.
+   */
+  void clear(SDL_Color color);
+
+  /**
+   * Draws everything queued for the frame so far, on whichever backend draws the frames: the
+   * software backend rasterizes it, and the SDL renderer submits its batched commands. Call
+   * before stopping a render timer, so the time covers the drawing and not only the queuing.
+   */
+  void finishFrame();
+
+  /**
+   * Shows the frame, on whichever backend draws the frames, first drawing anything queued
+   * since `finishFrame`. May wait for the display.
+   */
+  void present();
+
   /**
    * @brief Cleans up the SDL resources.
    *
@@ -1,4 +1,5 @@
 #include "../../includes/AssetManagement/AudioSampleQueue.hpp"
+#include "../../includes/Helpers/Profiler.hpp"
 
 AudioSampleQueue::AudioSampleQueue(AudioManager &audioManager) :
     m_audioManager(audioManager),
@@ -28,6 +29,7 @@ void AudioSampleQueue::queueSample(const AudioSample         sample,
 }
 
 void AudioSampleQueue::update() {
+  PROFILE_ZONE("AudioSampleQueue::update");
   const Uint64     currentTime           = SDL_GetTicks64();
   size_t           soundsPlayedThisFrame = 0;
   constexpr size_t MAX_SOUNDS_PER_FRAME  = AudioManager::MAX_SAMPLES_PER_FRAME;
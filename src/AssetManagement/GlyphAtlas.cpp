@@ -0,0 +1,108 @@
+#include "../../includes/AssetManagement/GlyphAtlas.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace {
+  constexpr SDL_Color GLYPH_COLOR = {.r = 255, .g = 255, .b = 255, .a = 255};
+} // namespace
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer     *renderer,
+                       TTF_Font         *font,
+                       SoftwareRenderer *softwareRenderer) {
+  std::vector<SDL_Surface *> surfaces(GLYPH_COUNT, nullptr);
+
+  const auto freeSurfaces = [&surfaces]() -> void {
+    for (SDL_Surface *&surface : surfaces) {
+      SDL_FreeSurface(surface);
+      surface = nullptr;
+    }
+  };
+
+  for (size_t index = 0; index < GLYPH_COUNT; index++) {
+    const auto character = static_cast<Uint32>(FIRST_GLYPH + index);
+    if (!TTF_GlyphIsProvided32(font, character)) {
+      continue;
+    }
+
+    int minX    = 0;
+    int maxX    = 0;
+    int minY    = 0;
+    int maxY    = 0;
+    int advance = 0;
+    if (TTF_GlyphMetrics32(font, character, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+      continue;
+    }
+
+    SDL_Surface *surface = TTF_RenderGlyph32_Blended(font, character, GLYPH_COLOR);
+    if (surface == nullptr) {
+      freeSurfaces();
+      throw std::runtime_error(std::string("Could not render a glyph: ") + TTF_GetError());
+    }
+
+    surfaces[index] = surface;
+    m_glyphs[index] = {
+        .width     = surface->w,
+        .height    = surface->h,
+        .advance   = advance,
+        .texCoords = {},
+        .provided  = true,
+    };
+  }
+
+  try {
+    m_atlas = TextureAtlas(renderer, softwareRenderer, surfaces);
+  } catch (const std::runtime_error &) {
+    freeSurfaces();
+    throw;
+  }
+  freeSurfaces();
+
+  // All of a font's glyphs fit on one page at any size the game renders text at.
+  if (m_atlas.getPageCount() > 1) {
+    throw std::runtime_error("The glyphs do not fit in a single atlas page");
+  }
+  for (size_t index = 0; index < GLYPH_COUNT; index++) {
+    if (m_glyphs[index].provided) {
+      m_glyphs[index].texCoords = m_atlas.getRegion(index)->texCoords;
+    }
+  }
+
+  m_kerning.resize(GLYPH_COUNT * GLYPH_COUNT);
+  for (size_t previous = 0; previous < GLYPH_COUNT; previous++) {
+    for (size_t next = 0; next < GLYPH_COUNT; next++) {
+      m_kerning[previous * GLYPH_COUNT + next] =
+          TTF_GetFontKerningSizeGlyphs32(font,
+                                         static_cast<Uint32>(FIRST_GLYPH + previous),
+                                         static_cast<Uint32>(FIRST_GLYPH + next));
+    }
+  }
+}
+
+size_t GlyphAtlas::getGlyphIndex(const char character) {
+  if (character < FIRST_GLYPH || character > LAST_GLYPH) {
+    return GLYPH_COUNT;
+  }
+  return static_cast<size_t>(character - FIRST_GLYPH);
+}
+
+SDL_Texture *GlyphAtlas::getTexture() const {
+  return m_atlas.getPageCount() == 0 ? nullptr : m_atlas.getPage(0);
+}
+
+const GlyphAtlas::Glyph *GlyphAtlas::getGlyph(const char character) const {
+  const size_t index = getGlyphIndex(character);
+  if (index == GLYPH_COUNT || !m_glyphs[index].provided) {
+    return nullptr;
+  }
+  return &m_glyphs[index];
+}
+
+int GlyphAtlas::getKerning(const char previous, const char next) const {
+  const size_t previousIndex = getGlyphIndex(previous);
+  const size_t nextIndex     = getGlyphIndex(next);
+  if (previousIndex == GLYPH_COUNT || nextIndex == GLYPH_COUNT) {
+    return 0;
+  }
+  return m_kerning[previousIndex * GLYPH_COUNT + nextIndex];
+}
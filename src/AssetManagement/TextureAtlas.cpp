@@ -0,0 +1,280 @@
+#include "../../includes/AssetManagement/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+  // Used when the renderer does not report a maximum texture size.
+  constexpr int DEFAULT_PAGE_SIZE = 2048;
+
+  // Keeps filtering from bleeding neighbouring images into each other.
+  constexpr int IMAGE_PADDING = 1;
+
+  /**
+   * Bottom-left skyline packing: the skyline follows the top edge of the packed rects across
+   * the page, and each new rect goes where its own top edge ends up lowest.
+   */
+  class SkylinePacker {
+    struct Segment {
+      int x;
+      int y;
+      int width;
+    };
+
+    int                  m_width;
+    int                  m_height;
+    std::vector<Segment> m_skyline;
+    int                  m_usedWidth  = 0;
+    int                  m_usedHeight = 0;
+
+    /**
+     * The y a rect would rest at with its left edge at the segment's, or nothing if it would
+     * stick out of the page.
+     */
+    std::optional<int> getRestingY(const size_t segmentIndex,
+                                   const int    width,
+                                   const int    height) const {
+      if (m_skyline[segmentIndex].x + width > m_width) {
+        return std::nullopt;
+      }
+
+      int y         = 0;
+      int remaining = width;
+      for (size_t index = segmentIndex; remaining > 0; index++) {
+        y         = std::max(y, m_skyline[index].y);
+        remaining = remaining - m_skyline[index].width;
+      }
+      if (y + height > m_height) {
+        return std::nullopt;
+      }
+      return y;
+    }
+
+  public:
+    SkylinePacker(const int width, const int height) :
+        m_width(width), m_height(height), m_skyline{{.x = 0, .y = 0, .width = width}} {}
+
+    /**
+     * Places a rect and returns its top left corner, or nothing if the page has no room.
+     */
+    std::optional<SDL_Point> insert(const int width, const int height) {
+      size_t bestIndex  = m_skyline.size();
+      int    bestBottom = 0;
+      int    bestY      = 0;
+      for (size_t index = 0; index < m_skyline.size(); index++) {
+        const std::optional<int> y = getRestingY(index, width, height);
+        if (!y.has_value()) {
+          continue;
+        }
+
+        // Prefer the lowest placement, then the narrowest segment, which wastes the least.
+        const int  bottom = *y + height;
+        const bool better = bestIndex == m_skyline.size() || bottom < bestBottom ||
+                            (bottom == bestBottom &&
+                             m_skyline[index].width < m_skyline[bestIndex].width);
+        if (better) {
+          bestIndex  = index;
+          bestBottom = bottom;
+          bestY      = *y;
+        }
+      }
+      if (bestIndex == m_skyline.size()) {
+        return std::nullopt;
+      }
+
+      const SDL_Point position = {.x = m_skyline[bestIndex].x, .y = bestY};
+      const int       right    = position.x + width;
+
+      // Cut the segments under the rect away and raise the skyline to its top edge.
+      size_t index = bestIndex;
+      while (index < m_skyline.size() && m_skyline[index].x < right) {
+        Segment  &segment      = m_skyline[index];
+        const int segmentRight = segment.x + segment.width;
+        if (segmentRight <= right) {
+          m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(index));
+          continue;
+        }
+        segment.x     = right;
+        segment.width = segmentRight - right;
+        break;
+      }
+      m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex),
+                       {.x = position.x, .y = bestBottom, .width = width});
+
+      for (size_t merged = 0; merged + 1 < m_skyline.size();) {
+        if (m_skyline[merged].y == m_skyline[merged + 1].y) {
+          m_skyline[merged].width = m_skyline[merged].width + m_skyline[merged + 1].width;
+          m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(merged + 1));
+        } else {
+          merged++;
+        }
+      }
+
+      m_usedWidth  = std::max(m_usedWidth, right);
+      m_usedHeight = std::max(m_usedHeight, bestBottom);
+      return position;
+    }
+
+    int getUsedWidth() const {
+      return m_usedWidth;
+    }
+
+    int getUsedHeight() const {
+      return m_usedHeight;
+    }
+  };
+} // namespace
+
+TextureAtlas::TextureAtlas(SDL_Renderer                     *renderer,
+                           SoftwareRenderer                 *softwareRenderer,
+                           const std::vector<SDL_Surface *> &images) :
+    m_regions(images.size()) {
+  int              maxWidth  = DEFAULT_PAGE_SIZE;
+  int              maxHeight = DEFAULT_PAGE_SIZE;
+  SDL_RendererInfo info{};
+  if (SDL_GetRendererInfo(renderer, &info) == 0 && info.max_texture_width > 0 &&
+      info.max_texture_height > 0) {
+    maxWidth  = info.max_texture_width;
+    maxHeight = info.max_texture_height;
+  }
+
+  // Taller images first pack tighter; the index breaks ties so the layout only depends on
+  // the order the caller lists the images in.
+  std::vector<size_t> order;
+  for (size_t imageIndex = 0; imageIndex < images.size(); imageIndex++) {
+    if (images[imageIndex] != nullptr) {
+      order.push_back(imageIndex);
+    }
+  }
+  std::ranges::stable_sort(order, [&images](const size_t first, const size_t second) -> bool {
+    return images[first]->h > images[second]->h;
+  });
+
+  struct Placement {
+    size_t   imageIndex;
+    SDL_Rect rect;
+  };
+  struct Page {
+    SkylinePacker          packer;
+    std::vector<Placement> placements = {};
+  };
+
+  std::vector<Page> pages;
+  for (const size_t imageIndex : order) {
+    const SDL_Surface *image  = images[imageIndex];
+    const int          width  = image->w + IMAGE_PADDING;
+    const int          height = image->h + IMAGE_PADDING;
+
+    std::optional<SDL_Point> position;
+    Page                    *page = nullptr;
+    for (Page &candidate : pages) {
+      position = candidate.packer.insert(width, height);
+      if (position.has_value()) {
+        page = &candidate;
+        break;
+      }
+    }
+
+    // Images too large for a page get one of their own, which the renderer may reject.
+    if (page == nullptr) {
+      pages.push_back({
+          .packer = SkylinePacker(std::max(maxWidth, width), std::max(maxHeight, height)),
+      });
+      page     = &pages.back();
+      position = page->packer.insert(width, height);
+    }
+
+    page->placements.push_back({
+        .imageIndex = imageIndex,
+        .rect       = {.x = position->x, .y = position->y, .w = image->w, .h = image->h},
+    });
+  }
+
+  for (const Page &page : pages) {
+    const int    pageWidth  = page.packer.getUsedWidth();
+    const int    pageHeight = page.packer.getUsedHeight();
+    SDL_Surface *atlas      = SDL_CreateRGBSurfaceWithFormat(
+        0, pageWidth, pageHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (atlas == nullptr) {
+      destroyPages();
+      throw std::runtime_error(std::string("Could not create an atlas page: ") +
+                               SDL_GetError());
+    }
+
+    for (const Placement &placement : page.placements) {
+      SDL_Surface *image = images[placement.imageIndex];
+      SDL_Rect     rect  = placement.rect;
+
+      // Copy the image's alpha as is rather than blending it over the empty page.
+      SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+      SDL_BlitSurface(image, nullptr, atlas, &rect);
+    }
+
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, atlas);
+    if (texture == nullptr) {
+      SDL_FreeSurface(atlas);
+      destroyPages();
+      throw std::runtime_error(std::string("Could not upload an atlas page: ") +
+                               SDL_GetError());
+    }
+    if (softwareRenderer != nullptr) {
+      softwareRenderer->registerTexture(texture, atlas);
+    }
+    SDL_FreeSurface(atlas);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+    const size_t pageIndex = m_pages.size();
+    m_pages.push_back(texture);
+    for (const Placement &placement : page.placements) {
+      const SDL_Rect &rect = placement.rect;
+      m_regions[placement.imageIndex] = Region{
+          .pageIndex = pageIndex,
+          .texCoords =
+              {
+                  .x = static_cast<float>(rect.x) / static_cast<float>(pageWidth),
+                  .y = static_cast<float>(rect.y) / static_cast<float>(pageHeight),
+                  .w = static_cast<float>(rect.w) / static_cast<float>(pageWidth),
+                  .h = static_cast<float>(rect.h) / static_cast<float>(pageHeight),
+              },
+      };
+    }
+  }
+}
+
+TextureAtlas::~TextureAtlas() {
+  destroyPages();
+}
+
+TextureAtlas::TextureAtlas(TextureAtlas &&other) noexcept :
+    m_pages(std::exchange(other.m_pages, {})), m_regions(std::exchange(other.m_regions, {})) {}
+
+TextureAtlas &TextureAtlas::operator=(TextureAtlas &&other) noexcept {
+  if (this != &other) {
+    destroyPages();
+    m_pages   = std::exchange(other.m_pages, {});
+    m_regions = std::exchange(other.m_regions, {});
+  }
+  return *this;
+}
+
+void TextureAtlas::destroyPages() {
+  for (SDL_Texture *page : m_pages) {
+    SDL_DestroyTexture(page);
+  }
+  m_pages.clear();
+}
+
+const TextureAtlas::Region *TextureAtlas::getRegion(const size_t imageIndex) const {
+  const std::optional<Region> &region = m_regions.at(imageIndex);
+  return region.has_value() ? &*region : nullptr;
+}
+
+SDL_Texture *TextureAtlas::getPage(const size_t pageIndex) const {
+  return m_pages.at(pageIndex);
+}
+
+size_t TextureAtlas::getPageCount() const {
+  return m_pages.size();
+}
@@ -1,53 +1,77 @@
 #include "../../includes/AssetManagement/TextureManager.hpp"
 #include <SDL2/SDL.h>
 #include <SDL_image.h>
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
-#include <ranges>
+#include <stdexcept>
 
-TextureManager::TextureManager(SDL_Renderer *renderer) :
-    m_renderer(renderer) {
+TextureManager::TextureManager(SDL_Renderer *renderer, SoftwareRenderer *softwareRenderer) :
+    m_renderer(renderer), m_softwareRenderer(softwareRenderer) {
   if (IMG_Init(IMG_INIT_PNG | IMG_INIT_JPG) == -1) {
     std::cout << "SDL_image could not initialize! SDL_image Error: %s\n" << IMG_GetError();
   }
 
-  for (const auto &name : imagePaths | std::views::keys) {
-    loadTexture(name);
+  std::vector<std::pair<TextureName, SDL_Surface *>> images;
+  for (const auto &[name, path] : imagePaths) {
+    SDL_Surface *img = IMG_Load(path.c_str());
+    if (img == nullptr) {
+      std::cout << "Unable to load image! SDL_image Error:\n"
+                << path.c_str() << IMG_GetError();
+      continue;
+    }
+    images.emplace_back(name, img);
   }
-  SDL_Log("TextureManager created.");
+
+  buildAtlases(images);
+  SDL_Log("TextureManager created with %zu atlas textures.", m_atlas.getPageCount());
 }
 
 TextureManager::~TextureManager() {
   std::cout << "ImageManager destroyed\n";
-  for (auto &[name, surface] : m_surfaces) {
-    SDL_FreeSurface(surface);
-    SDL_Log("Surface %d freed", name);
-  }
+}
 
-  for (auto &[name, texture] : m_textures) {
-    SDL_DestroyTexture(texture);
-    SDL_Log("Texture %d freed", name);
+void TextureManager::buildAtlases(std::vector<std::pair<TextureName, SDL_Surface *>> &images) {
+  // The atlas breaks ties between images of the same height by their order, so sort by name
+  // first to get the same layout on every run.
+  std::ranges::sort(images, [](const auto &first, const auto &second) -> bool {
+    return first.first < second.first;
+  });
+
+  std::vector<SDL_Surface *> surfaces;
+  surfaces.reserve(images.size());
+  for (const auto &image : images) {
+    surfaces.push_back(image.second);
   }
-}
 
-void TextureManager::loadTexture(const TextureName name) {
-  const std::filesystem::path &path = imagePaths.at(name);
-  SDL_Surface                 *img  = IMG_Load(path.c_str());
+  try {
+    m_atlas = TextureAtlas(m_renderer, m_softwareRenderer, surfaces);
+  } catch (const std::runtime_error &error) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_RENDER, "Could not build the texture atlas: %s", error.what());
+  }
 
-  if (img == nullptr) {
-    std::cout << "Unable to load image! SDL_image Error:\n" << path.c_str() << IMG_GetError();
+  if (m_atlas.getPageCount() > 0) {
+    for (size_t imageIndex = 0; imageIndex < images.size(); imageIndex++) {
+      const TextureAtlas::Region *region = m_atlas.getRegion(imageIndex);
+      m_regions[images[imageIndex].first] = {
+          .textureIndex = region->pageIndex,
+          .texCoords    = region->texCoords,
+      };
+    }
   }
 
-  m_surfaces[name] = img;
-  m_textures[name] = SDL_CreateTextureFromSurface(m_renderer, img);
+  for (const auto &image : images) {
+    SDL_FreeSurface(image.second);
+  }
+  images.clear();
 }
 
-SDL_Texture *TextureManager::getTexture(const TextureName name) {
-  if (std::ranges::find_if(imagePaths, [&](const auto &pair) { return pair.first == name; }) ==
-      imagePaths.end()) {
-    std::cout << "Image not found in ImageManager\n";
-    return nullptr;
-  }
+const SpriteRegion *TextureManager::getSpriteRegion(const TextureName name) const {
+  const auto region = m_regions.find(name);
+  return region == m_regions.end() ? nullptr : &region->second;
+}
 
-  return m_textures[name];
+SDL_Texture *TextureManager::getTexture(const size_t textureIndex) const {
+  return m_atlas.getPage(textureIndex);
 }
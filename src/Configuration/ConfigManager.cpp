@@ -1,4 +1,5 @@
 #include "../../includes/Configuration/ConfigManager.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
 #include <fstream>
 
 template <typename JsonReturnType>
@@ -12,11 +13,11 @@ JsonReturnType ConfigManager::getJsonValue(const json        &jsonValue,
   }
 }
 
-SDL_Color ConfigManager::parseColor(const json &colorJson, const std::string &context) {
-  const auto red   = getJsonValue<Uint8>(colorJson, "r", context);
-  const auto green = getJsonValue<Uint8>(colorJson, "g", context);
-  const auto blue  = getJsonValue<Uint8>(colorJson, "b", context);
-  const auto alpha = getJsonValue<Uint8>(colorJson, "a", context);
+Color ConfigManager::parseColor(const json &colorJson, const std::string &context) {
+  const auto red   = getJsonValue<std::uint8_t>(colorJson, "r", context);
+  const auto green = getJsonValue<std::uint8_t>(colorJson, "g", context);
+  const auto blue  = getJsonValue<std::uint8_t>(colorJson, "b", context);
+  const auto alpha = getJsonValue<std::uint8_t>(colorJson, "a", context);
 
   return {.r = red, .g = green, .b = blue, .a = alpha};
 }
@@ -25,7 +26,7 @@ ShapeConfig ConfigManager::parseShapeConfig(const json        &shapeJson,
                                             const std::string &context) {
   const auto      height = getJsonValue<float>(shapeJson, "height", context);
   const auto      width  = getJsonValue<float>(shapeJson, "width", context);
-  const SDL_Color color  = parseColor(shapeJson["color"], context + ".color");
+  const Color     color  = parseColor(shapeJson["color"], context + ".color");
 
   return {height, width, color};
 }
@@ -40,7 +41,7 @@ void ConfigManager::parseGameConfig() {
   const auto windowTitle =
       getJsonValue<std::string>(gameConfigJson, "windowTitle", "gameConfig");
   const auto spawnInterval =
-      getJsonValue<Uint64>(gameConfigJson, "spawnInterval", "gameConfig");
+      getJsonValue<std::uint64_t>(gameConfigJson, "spawnInterval", "gameConfig");
 
   m_gameConfig.windowSize    = Vec2(windowWidth, windowHeight);
   m_gameConfig.windowTitle   = windowTitle;
@@ -55,10 +56,11 @@ void ConfigManager::parseGameConfig() {
 void ConfigManager::parseItemConfig() {
   const auto &config = m_json["itemConfig"];
 
-  m_itemConfig.lifespan        = getJsonValue<Uint64>(config, "lifespan", "itemConfig");
-  m_itemConfig.speed           = getJsonValue<float>(config, "speed", "itemConfig");
-  m_itemConfig.spawnPercentage = getJsonValue<Uint8>(config, "spawnPercentage", "itemConfig");
-  m_itemConfig.shape           = parseShapeConfig(config["shape"], "itemConfig.shape");
+  m_itemConfig.lifespan = getJsonValue<std::uint64_t>(config, "lifespan", "itemConfig");
+  m_itemConfig.speed    = getJsonValue<float>(config, "speed", "itemConfig");
+  m_itemConfig.spawnPercentage =
+      getJsonValue<std::uint8_t>(config, "spawnPercentage", "itemConfig");
+  m_itemConfig.shape = parseShapeConfig(config["shape"], "itemConfig.shape");
 
   if (m_itemConfig.spawnPercentage > 100) {
     throw ConfigurationError("Item spawn percentage must be between 0 and 100");
@@ -69,9 +71,9 @@ void ConfigManager::parseEnemyConfig() {
   const auto &config = m_json["enemyConfig"];
 
   m_enemyConfig.speed    = getJsonValue<float>(config, "speed", "enemyConfig");
-  m_enemyConfig.lifespan = getJsonValue<Uint64>(config, "lifespan", "enemyConfig");
+  m_enemyConfig.lifespan = getJsonValue<std::uint64_t>(config, "lifespan", "enemyConfig");
   m_enemyConfig.spawnPercentage =
-      getJsonValue<Uint8>(config, "spawnPercentage", "enemyConfig");
+      getJsonValue<std::uint8_t>(config, "spawnPercentage", "enemyConfig");
   m_enemyConfig.shape = parseShapeConfig(config["shape"], "enemyConfig.shape");
 
   if (m_enemyConfig.spawnPercentage > 100) {
@@ -82,9 +84,10 @@ void ConfigManager::parseEnemyConfig() {
 void ConfigManager::parseSpeedEffectConfig() {
   const auto &config = m_json["speedEffectConfig"];
 
-  m_speedEffectConfig.speed    = getJsonValue<float>(config, "speed", "speedEffectConfig");
-  m_speedEffectConfig.lifespan = getJsonValue<Uint64>(config, "lifespan", "speedEffectConfig");
-  m_speedEffectConfig.shape    = parseShapeConfig(config["shape"], "speedEffectConfig.shape");
+  m_speedEffectConfig.speed = getJsonValue<float>(config, "speed", "speedEffectConfig");
+  m_speedEffectConfig.lifespan =
+      getJsonValue<std::uint64_t>(config, "lifespan", "speedEffectConfig");
+  m_speedEffectConfig.shape = parseShapeConfig(config["shape"], "speedEffectConfig.shape");
 
   m_speedEffectConfig.spawnPercentage =
       getJsonValue<unsigned int>(config, "spawnPercentage", "speedEffectConfig");
@@ -99,7 +102,7 @@ void ConfigManager::parseSlownessEffectConfig() {
 
   m_slownessEffectConfig.speed = getJsonValue<float>(config, "speed", "slownessEffectConfig");
   m_slownessEffectConfig.lifespan =
-      getJsonValue<Uint64>(config, "lifespan", "slownessEffectConfig");
+      getJsonValue<std::uint64_t>(config, "lifespan", "slownessEffectConfig");
   m_slownessEffectConfig.spawnPercentage =
       getJsonValue<unsigned int>(config, "spawnPercentage", "slownessEffectConfig");
   m_slownessEffectConfig.shape =
@@ -114,10 +117,126 @@ void ConfigManager::parseBulletConfig() {
   const auto &config = m_json["bulletConfig"];
 
   m_bulletConfig.speed    = getJsonValue<float>(config, "speed", "bulletConfig");
-  m_bulletConfig.lifespan = getJsonValue<Uint64>(config, "lifespan", "bulletConfig");
+  m_bulletConfig.lifespan = getJsonValue<std::uint64_t>(config, "lifespan", "bulletConfig");
   m_bulletConfig.shape    = parseShapeConfig(config["shape"], "bulletConfig.shape");
 }
 
+void ConfigManager::parseRewindConfig() {
+  const auto &config = m_json["rewindConfig"];
+
+  const auto memoryBudgetMegabytes =
+      getJsonValue<size_t>(config, "memoryBudgetMegabytes", "rewindConfig");
+  m_rewindConfig.memoryBudget = memoryBudgetMegabytes * 1024 * 1024;
+  m_rewindConfig.keyframeInterval =
+      getJsonValue<std::uint64_t>(config, "keyframeInterval", "rewindConfig");
+
+  if (m_rewindConfig.keyframeInterval == 0) {
+    throw ConfigurationError("Rewind keyframe interval must be at least one tick");
+  }
+}
+
+void ConfigManager::parseSpawnBudgetConfig() {
+  const auto &config = m_json["spawnBudgetConfig"];
+
+  m_spawnBudgetConfig.enabled = getJsonValue<bool>(config, "enabled", "spawnBudgetConfig");
+  m_spawnBudgetConfig.frameTimeTarget =
+      getJsonValue<float>(config, "frameTimeTargetMs", "spawnBudgetConfig");
+  m_spawnBudgetConfig.cullingEnabled =
+      getJsonValue<bool>(config, "cullingEnabled", "spawnBudgetConfig");
+  m_spawnBudgetConfig.maxCullPerAdjustment =
+      getJsonValue<std::uint8_t>(config, "maxCullPerAdjustment", "spawnBudgetConfig");
+
+  if (m_spawnBudgetConfig.frameTimeTarget <= 0) {
+    throw ConfigurationError("Spawn budget frame time target must be positive");
+  }
+}
+
+void ConfigManager::parseFrameStatsConfig() {
+  const auto &config = m_json["frameStatsConfig"];
+
+  m_frameStatsConfig.frameTimeTarget =
+      getJsonValue<float>(config, "frameTimeTargetMs", "frameStatsConfig");
+
+  if (m_frameStatsConfig.frameTimeTarget <= 0) {
+    throw ConfigurationError("Frame time target must be positive");
+  }
+}
+
+void ConfigManager::parseFramePacingConfig() {
+  const auto &config = m_json["framePacingConfig"];
+
+  const auto mode = getJsonValue<std::string>(config, "mode", "framePacingConfig");
+  if (mode == "vsync") {
+    m_framePacingConfig.mode = FramePacingMode::VSYNC;
+  } else if (mode == "cap") {
+    m_framePacingConfig.mode = FramePacingMode::CAP;
+  } else if (mode == "uncapped") {
+    m_framePacingConfig.mode = FramePacingMode::UNCAPPED;
+  } else {
+    throw ConfigurationError("Frame pacing mode must be vsync, cap or uncapped, not " + mode);
+  }
+
+  m_framePacingConfig.frameRateCap =
+      getJsonValue<float>(config, "frameRateCap", "framePacingConfig");
+  m_framePacingConfig.spinThreshold =
+      getJsonValue<float>(config, "spinThresholdMs", "framePacingConfig");
+
+  if (m_framePacingConfig.frameRateCap <= 0) {
+    throw ConfigurationError("Frame rate cap must be positive");
+  }
+  if (m_framePacingConfig.spinThreshold < 0) {
+    throw ConfigurationError("Frame pacing spin threshold must not be negative");
+  }
+}
+
+void ConfigManager::parseRenderConfig() {
+  const auto &config = m_json["renderConfig"];
+
+  const auto backend = getJsonValue<std::string>(config, "backend", "renderConfig");
+  if (backend == "sdl") {
+    m_renderConfig.backend = RenderBackend::SDL;
+  } else if (backend == "software") {
+    m_renderConfig.backend = RenderBackend::SOFTWARE;
+  } else {
+    throw ConfigurationError("Render backend must be sdl or software, not " + backend);
+  }
+}
+
+void ConfigManager::parseStressConfig() {
+  const auto &config = m_json["stressConfig"];
+
+  m_stressConfig.stages.clear();
+  for (const auto &stageJson : getJsonValue<json>(config, "stages", "stressConfig")) {
+    const std::string context    = "stressConfig.stages";
+    const json        population = getJsonValue<json>(stageJson, "population", context);
+
+    const auto getCount = [&population, &context](const std::string &key) -> size_t {
+      return getJsonValue<size_t>(population, key, context + ".population");
+    };
+
+    m_stressConfig.stages.push_back({
+        .population =
+            {
+                .enemies         = getCount("enemies"),
+                .bullets         = getCount("bullets"),
+                .items           = getCount("items"),
+                .speedBoosts     = getCount("speedBoosts"),
+                .slownessDebuffs = getCount("slownessDebuffs"),
+            },
+        .rampFrames = getJsonValue<std::uint64_t>(stageJson, "rampFrames", context),
+        .holdFrames = getJsonValue<std::uint64_t>(stageJson, "holdFrames", context),
+    });
+
+    if (m_stressConfig.stages.back().holdFrames == 0) {
+      throw ConfigurationError("Stress test stages must hold for at least one frame");
+    }
+  }
+
+  if (m_stressConfig.stages.empty()) {
+    throw ConfigurationError("Stress test must have at least one stage");
+  }
+}
+
 void ConfigManager::parsePlayerConfig() {
   const auto &config = m_json["playerConfig"];
 
@@ -142,6 +261,12 @@ void ConfigManager::parseConfig() {
     parseBulletConfig();
     parseSpeedEffectConfig();
     parseSlownessEffectConfig();
+    parseRewindConfig();
+    parseSpawnBudgetConfig();
+    parseFrameStatsConfig();
+    parseFramePacingConfig();
+    parseRenderConfig();
+    parseStressConfig();
   } catch (const json::exception &e) {
     throw ConfigurationError("JSON parsing error: " + std::string(e.what()));
   }
@@ -171,12 +296,9 @@ ConfigManager::ConfigManager(std::filesystem::path configPath) :
     m_configPath(std::move(configPath)) {
   try {
     loadConfig();
-    SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
-                "ConfigManager successfully loaded: %s",
-                m_configPath.c_str());
+    LogHelpers::logInfo("ConfigManager successfully loaded: %s", m_configPath.c_str());
   } catch (const ConfigurationError &e) {
-    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Configuration error: %s", e.what());
-    std::cerr << e.what() << std::endl;
+    LogHelpers::logError("Configuration error: %s", e.what());
     throw;
   }
 }
@@ -209,6 +331,30 @@ const SlownessEffectConfig &ConfigManager::getSlownessEffectConfig() const {
   return m_slownessEffectConfig;
 }
 
+const RewindConfig &ConfigManager::getRewindConfig() const {
+  return m_rewindConfig;
+}
+
+const SpawnBudgetConfig &ConfigManager::getSpawnBudgetConfig() const {
+  return m_spawnBudgetConfig;
+}
+
+const FrameStatsConfig &ConfigManager::getFrameStatsConfig() const {
+  return m_frameStatsConfig;
+}
+
+const FramePacingConfig &ConfigManager::getFramePacingConfig() const {
+  return m_framePacingConfig;
+}
+
+const RenderConfig &ConfigManager::getRenderConfig() const {
+  return m_renderConfig;
+}
+
+const StressConfig &ConfigManager::getStressConfig() const {
+  return m_stressConfig;
+}
+
 void ConfigManager::updatePlayerShape(const ShapeConfig &shape) {
   m_playerConfig.shape = shape;
 }
@@ -1,5 +1,5 @@
 #include "../../includes/EntityManagement/Entity.hpp"
-#include <iostream>
+#include "../../includes/Helpers/LogHelpers.hpp"
 
 Entity::Entity(const size_t id, const EntityTags tag) :
     m_id(id), m_tag(tag) {}
@@ -25,9 +25,8 @@ Vec2 Entity::getCenterPos() const {
   const std::shared_ptr<CShape>     &cShape     = getComponent<CShape>();
 
   if (cTransform == nullptr || cShape == nullptr) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR,
-                 "Entity lacks a transform or shape component. Unable to calculate center "
-                 "position.");
+    LogHelpers::logError("Entity lacks a transform or shape component. Unable to calculate "
+                         "center position.");
     return {0, 0};
   }
 
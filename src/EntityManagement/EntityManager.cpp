@@ -1,6 +1,7 @@
 
 #include "../../includes/EntityManagement/EntityManager.hpp"
 #include "../../includes/EntityManagement/Entity.hpp"
+#include "../../includes/Helpers/Profiler.hpp"
 #include <ranges> // For std::ranges::views
 
 EntityManager::EntityManager() = default;
@@ -14,11 +15,21 @@ std::shared_ptr<Entity> EntityManager::addEntity(const EntityTags tag) {
 EntityVector &EntityManager::getEntities() {
   return m_entities;
 }
+const EntityVector &EntityManager::getEntities() const {
+  return m_entities;
+}
 EntityVector &EntityManager::getEntities(const EntityTags tag) {
   return m_entityMap[tag];
 }
+const EntityVector &EntityManager::getPendingEntities() const {
+  return m_toAdd;
+}
+size_t EntityManager::getTotalEntities() const {
+  return m_totalEntities;
+}
 
 void EntityManager::update() {
+  PROFILE_ZONE("EntityManager::update");
   auto removeDeadEntities = [](EntityVector &entityVec) {
     std::erase_if(entityVec, [](auto &entity) { return !entity->isActive(); });
   };
@@ -38,3 +49,40 @@ void EntityManager::update() {
 
   m_toAdd.clear();
 }
+
+void EntityManager::clear(const size_t totalEntities) {
+  m_entities.clear();
+  m_toAdd.clear();
+  m_entityMap.clear();
+  m_totalEntities = totalEntities;
+}
+
+bool EntityManager::truncate(const size_t totalEntities) {
+  for (const std::shared_ptr<Entity> &entity : m_entities) {
+    if (entity->id() >= totalEntities) {
+      entity->destroy();
+    }
+  }
+  for (const std::shared_ptr<Entity> &entity : m_toAdd) {
+    if (entity->id() >= totalEntities) {
+      entity->destroy();
+    }
+  }
+
+  update();
+  m_totalEntities = totalEntities;
+  return m_entities.size() == totalEntities;
+}
+
+std::shared_ptr<Entity>
+EntityManager::restoreEntity(const size_t id, const EntityTags tag, const bool pending) {
+  auto entity = std::shared_ptr<Entity>(new Entity(id, tag));
+  if (pending) {
+    m_toAdd.push_back(entity);
+    return entity;
+  }
+
+  m_entities.push_back(entity);
+  m_entityMap[tag].push_back(entity);
+  return entity;
+}
@@ -1,13 +1,25 @@
 #include "../../includes/GameEngine/GameEngine.hpp"
 #include "../../../includes/GameScenes/MainScene/MainScene.hpp"
 #include "../../../includes/GameScenes/MenuScene/MenuScene.hpp"
+#include "../../../includes/GameScenes/StressScene/StressScene.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
 #include "../../includes/SystemManagement/VideoManager.hpp"
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
-GameEngine::GameEngine() {
+GameEngine::GameEngine(LaunchOptions launchOptions) :
+    m_launchOptions(std::move(launchOptions)) {
+  /*
+   * Route log messages from the simulation core through SDL's logging.
+   */
+  LogHelpers::setLogSink([](const LogHelpers::LogLevel level, const std::string &message) {
+    const SDL_LogPriority priority =
+        level == LogHelpers::LogLevel::ERROR ? SDL_LOG_PRIORITY_ERROR : SDL_LOG_PRIORITY_INFO;
+    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, priority, "%s", message.c_str());
+  });
+
   /*
    * Set up the paths for the assets and configuration files.
    *
@@ -40,8 +52,12 @@ GameEngine::GameEngine() {
   m_audioManager     = createAudioManager();
   m_audioSampleQueue = initializeAudioSampleQueue();
   m_fontManager      = createFontManager();
+  m_jobSystem        = createJobSystem();
   m_videoManager     = createVideoManager();
   m_texture_manager  = createTextureManager();
+  m_textRenderer     = createTextRenderer();
+  m_frameTimeLog     = createFrameTimeLog();
+  m_framePacer       = createFramePacer();
 
   /*
    * Set the game engine to running state.
@@ -51,14 +67,27 @@ GameEngine::GameEngine() {
   /*
    * Log to console that the game engine has been initialized successfully.
    *
-   * Sets up the menu scene and loads it into the game engine.
+   * Sets up the menu scene and loads it into the game engine. A replay skips the menu and
+   * goes straight to the main scene, and a stress test run straight to the stress scene.
    */
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Game engine initialized successfully!");
+  if (m_launchOptions.replayPath.has_value()) {
+    loadScene("Main", std::make_shared<MainScene>(this));
+    return;
+  }
+
+  if (m_launchOptions.stressReportPath.has_value()) {
+    loadScene("Stress", std::make_shared<StressScene>(this));
+    return;
+  }
+
   const std::shared_ptr<Scene> menuScene = std::make_shared<MenuScene>(this);
   loadScene("Menu", menuScene);
 }
 
 GameEngine::~GameEngine() {
+  // Scenes may own textures, which must be destroyed while the renderer is still alive.
+  m_scenes.clear();
   cleanup();
 }
 
@@ -67,17 +96,29 @@ std::unique_ptr<ConfigManager> GameEngine::createConfigManager(const Path &confi
 }
 
 std::unique_ptr<TextureManager> GameEngine::createTextureManager() const {
-  return std::make_unique<TextureManager>(m_videoManager->getRenderer());
+  return std::make_unique<TextureManager>(m_videoManager->getRenderer(),
+                                          m_videoManager->getSoftwareRenderer());
 }
 
 std::unique_ptr<VideoManager> GameEngine::createVideoManager() const {
-  if (m_configManager == nullptr) {
-    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "ConfigManager not initialized");
+  if (m_configManager == nullptr || m_jobSystem == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "ConfigManager or JobSystem not initialized");
     cleanup();
-    throw std::runtime_error("ConfigManager not initialized");
+    throw std::runtime_error("ConfigManager or JobSystem not initialized");
   }
 
-  return std::make_unique<VideoManager>(*m_configManager);
+  return std::make_unique<VideoManager>(*m_configManager, *m_jobSystem);
+}
+
+std::unique_ptr<TextRenderer> GameEngine::createTextRenderer() const {
+  if (m_videoManager == nullptr || m_fontManager == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "VideoManager or FontManager not initialized");
+    cleanup();
+    throw std::runtime_error("VideoManager or FontManager not initialized");
+  }
+
+  return std::make_unique<TextRenderer>(
+      m_videoManager->getRenderer(), *m_fontManager, m_videoManager->getSoftwareRenderer());
 }
 
 std::unique_ptr<AudioManager> GameEngine::createAudioManager() {
@@ -109,6 +150,102 @@ std::unique_ptr<FontManager> GameEngine::createFontManager() const {
   return std::make_unique<FontManager>(fontPath);
 }
 
+std::unique_ptr<JobSystem> GameEngine::createJobSystem() {
+  auto jobSystem = std::make_unique<JobSystem>();
+  SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Job system running on %zu thread(s)",
+              jobSystem->getThreadCount());
+  return jobSystem;
+}
+
+std::unique_ptr<FrameTimeLog> GameEngine::createFrameTimeLog() const {
+  if (m_configManager == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "ConfigManager not initialized");
+    cleanup();
+    throw std::runtime_error("ConfigManager not initialized");
+  }
+
+  const float frameTimeTarget = m_configManager->getFrameStatsConfig().frameTimeTarget;
+  return std::make_unique<FrameTimeLog>(static_cast<std::uint32_t>(frameTimeTarget * 1000));
+}
+
+std::unique_ptr<FramePacer> GameEngine::createFramePacer() const {
+  if (m_configManager == nullptr || m_videoManager == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "ConfigManager or VideoManager not initialized");
+    cleanup();
+    throw std::runtime_error("ConfigManager or VideoManager not initialized");
+  }
+
+  const FramePacingConfig &config    = m_configManager->getFramePacingConfig();
+  FramePacingMode          mode      = config.mode;
+  float                    frameRate = config.frameRateCap;
+
+  if (mode == FramePacingMode::VSYNC) {
+    SDL_DisplayMode displayMode{};
+    const int       displayIndex = SDL_GetWindowDisplayIndex(m_videoManager->getWindow());
+    if (displayIndex >= 0 && SDL_GetCurrentDisplayMode(displayIndex, &displayMode) == 0 &&
+        displayMode.refresh_rate > 0) {
+      frameRate = static_cast<float>(displayMode.refresh_rate);
+    }
+
+    SDL_RendererInfo rendererInfo{};
+    if (SDL_GetRendererInfo(m_videoManager->getRenderer(), &rendererInfo) != 0 ||
+        (rendererInfo.flags & SDL_RENDERER_PRESENTVSYNC) == 0) {
+      SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM,
+                  "Vsync is not available, capping the frame rate at %.0f instead",
+                  static_cast<double>(frameRate));
+      mode = FramePacingMode::CAP;
+    }
+  }
+
+  return std::make_unique<FramePacer>(mode, frameRate, config.spinThreshold);
+}
+
+void GameEngine::recordFrameTime() {
+  const Uint64 frameStart = SDL_GetPerformanceCounter();
+  if (m_lastFrameStart != 0) {
+    m_frameTimeLog->record(toMicroseconds(frameStart - m_lastFrameStart));
+  }
+  m_lastFrameStart = frameStart;
+}
+
+void GameEngine::saveFrameTimes() const {
+  for (const FrameTimeLog::SceneFrameTimes &scene : m_frameTimeLog->getScenes()) {
+    const FrameTimeHistogram &histogram = scene.histogram;
+    SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                "%s: %llu frames, p50 %u us, p99 %u us, max %u us, %llu hitches",
+                scene.sceneName.c_str(),
+                static_cast<unsigned long long>(histogram.getCount()),
+                histogram.getPercentile(50),
+                histogram.getPercentile(99),
+                histogram.getMax(),
+                static_cast<unsigned long long>(histogram.getHitchCount()));
+  }
+
+  // Uncapped and web builds do not pace, so they have nothing to report.
+  const FrameTimeHistogram &pacingErrors = m_framePacer->getPacingErrors();
+  if (pacingErrors.getCount() > 0) {
+    SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM,
+                "Frame pacing at %.0f fps: p50 error %u us, p99 error %u us, %llu frames "
+                "off by over 1 ms",
+                static_cast<double>(m_framePacer->getFrameRate()),
+                pacingErrors.getPercentile(50),
+                pacingErrors.getPercentile(99),
+                static_cast<unsigned long long>(pacingErrors.getHitchCount()));
+  }
+
+  const std::optional<Path> &frameStatsPath = m_launchOptions.frameStatsPath;
+  if (!frameStatsPath.has_value()) {
+    return;
+  }
+
+  try {
+    m_frameTimeLog->save(*frameStatsPath);
+    SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Saved frame stats to %s", frameStatsPath->c_str());
+  } catch (const std::runtime_error &error) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "Could not save frame stats: %s", error.what());
+  }
+}
+
 void GameEngine::cleanup() {
   SDL_Quit();
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Game engine cleaned up successfully!");
@@ -133,12 +270,14 @@ void GameEngine::run() {
 #else
   while (m_isRunning) {
     mainLoop(this);
+    m_framePacer->waitForNextFrame();
   }
 #endif
 }
 
 void GameEngine::quit() {
   SDL_LogInfo(SDL_LOG_CATEGORY_SYSTEM, "Quitting game engine...");
+  saveFrameTimes();
 #ifdef __EMSCRIPTEN__
   emscripten_cancel_main_loop();
 #else
@@ -148,6 +287,7 @@ void GameEngine::quit() {
 
 void GameEngine::loadScene(const std::string &sceneName, const std::shared_ptr<Scene> &scene) {
   m_scenes[sceneName] = scene;
+  m_frameTimeLog->beginScene(sceneName);
 
   scene->setStartTime(SDL_GetTicks64());
   m_currentSceneName = sceneName;
@@ -202,11 +342,58 @@ TextureManager &GameEngine::getTextureManager() const {
   return *m_texture_manager;
 }
 
+TextRenderer &GameEngine::getTextRenderer() const {
+  if (!m_textRenderer) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "TextRenderer not initialized");
+    throw std::runtime_error("TextRenderer not initialized");
+  }
+  return *m_textRenderer;
+}
+
+JobSystem &GameEngine::getJobSystem() const {
+  if (!m_jobSystem) {
+    SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "JobSystem not initialized");
+    throw std::runtime_error("JobSystem not initialized");
+  }
+  return *m_jobSystem;
+}
+
+std::uint32_t GameEngine::toMicroseconds(const Uint64 performanceCounterTicks) {
+  return static_cast<std::uint32_t>(performanceCounterTicks * 1000000 /
+                                    SDL_GetPerformanceFrequency());
+}
+
+const LaunchOptions &GameEngine::getLaunchOptions() const {
+  return m_launchOptions;
+}
+
+const FrameTimeLog &GameEngine::getFrameTimeLog() const {
+  return *m_frameTimeLog;
+}
+
 void GameEngine::sUserInput() {
   SDL_Event                    event;
   const std::shared_ptr<Scene> activeScene = m_scenes[m_currentSceneName];
 
-  while (SDL_PollEvent(&event)) {
+  bool hasEvent = false;
+#ifndef __EMSCRIPTEN__
+  if (activeScene->isIdle()) {
+    // Sleep until there is input, waking now and then for the scene's audio.
+    constexpr int IDLE_WAKE_INTERVAL = 100;
+    hasEvent = SDL_WaitEventTimeout(&event, IDLE_WAKE_INTERVAL) == 1;
+
+    // The wait is neither part of the frame's duration nor a missed pacing deadline.
+    m_lastFrameStart = SDL_GetPerformanceCounter();
+    m_framePacer->reset();
+  } else {
+    hasEvent = SDL_PollEvent(&event) == 1;
+  }
+#else
+  // The browser calls the main loop on every animation frame, so it cannot block.
+  hasEvent = SDL_PollEvent(&event) == 1;
+#endif
+
+  for (; hasEvent; hasEvent = SDL_PollEvent(&event) == 1) {
     if (event.type == SDL_QUIT) {
       quit();
       return;
@@ -225,6 +412,10 @@ void GameEngine::sUserInput() {
       }
     }
 
+    if (event.type == SDL_RENDER_TARGETS_RESET) {
+      activeScene->onRenderTargetsReset();
+    }
+
     if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
       if (!activeScene->getActionMap().contains(event.key.keysym.sym)) {
         continue;
@@ -285,6 +476,10 @@ void GameEngine::mainLoop(void *arg) {
     return;
   }
 #endif
+  gameEngine->recordFrameTime();
   gameEngine->sUserInput();
   gameEngine->update();
+
+  // Jobs that must run on the main thread, such as SDL calls, queued during the frame.
+  gameEngine->getJobSystem().runMainThreadJobs();
 }
@@ -0,0 +1,401 @@
+#include "../../includes/GameEngine/JobSystem.hpp"
+
+#include <algorithm>
+
+namespace {
+  // Identifies the worker threads' queues; the creating thread is recognised by its id.
+  thread_local const JobSystem *t_jobSystem = nullptr;
+  thread_local size_t           t_queueIndex = 0;
+
+  // Chunks per thread in a parallel for, so threads that finish early can take the rest.
+  constexpr size_t CHUNKS_PER_THREAD = 4;
+
+  // A parallel loop's claim counter packs the run, the run's chunk count and the next chunk.
+  constexpr int           RUN_SHIFT         = 32;
+  constexpr int           CHUNK_COUNT_SHIFT = 16;
+  constexpr std::uint64_t CHUNK_MASK        = 0xFFFF;
+
+  /**
+   * The number of items in each chunk of a parallel for over `itemCount` items; the whole
+   * range when it is too small to split.
+   */
+  size_t getChunkSize(const size_t itemCount, const size_t grainSize, const size_t threads) {
+    const size_t grain      = std::max<size_t>(grainSize, 1);
+    const size_t maxChunks  = (itemCount + grain - 1) / grain;
+    const size_t maxClaims  = static_cast<size_t>(CHUNK_MASK);
+    const size_t chunkCount = std::min({maxChunks, threads * CHUNKS_PER_THREAD, maxClaims});
+    return chunkCount <= 1 ? itemCount : (itemCount + chunkCount - 1) / chunkCount;
+  }
+} // namespace
+
+void JobSystem::JobQueue::push(std::shared_ptr<Job> job) {
+  if (count == slots.size()) {
+    std::vector<std::shared_ptr<Job>> grown(std::max<size_t>(slots.size() * 2, 16));
+    for (size_t index = 0; index < count; index++) {
+      grown[index] = std::move(slots[(first + index) % slots.size()]);
+    }
+    slots.swap(grown);
+    first = 0;
+  }
+
+  slots[(first + count) % slots.size()] = std::move(job);
+  count += 1;
+}
+
+std::shared_ptr<JobSystem::Job> JobSystem::JobQueue::takeNewest() {
+  if (count == 0) {
+    return nullptr;
+  }
+
+  count -= 1;
+  return std::move(slots[(first + count) % slots.size()]);
+}
+
+std::shared_ptr<JobSystem::Job> JobSystem::JobQueue::takeOldest() {
+  if (count == 0) {
+    return nullptr;
+  }
+
+  std::shared_ptr<Job> job = std::move(slots[first]);
+  first                    = (first + 1) % slots.size();
+  count -= 1;
+  return job;
+}
+
+bool JobSystem::JobHandle::isFinished() const {
+  return m_job == nullptr || m_job->finished.load(std::memory_order_acquire);
+}
+
+JobSystem::JobSystem(size_t threadCount) :
+    m_mainThreadId(std::this_thread::get_id()) {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  threadCount = 1;
+#endif
+  const size_t workerCount = threadCount > 1 ? threadCount - 1 : 0;
+
+  for (size_t queueIndex = 0; queueIndex <= workerCount; queueIndex++) {
+    m_queues.push_back(std::make_unique<JobQueue>());
+  }
+  for (size_t queueIndex = 1; queueIndex <= workerCount; queueIndex++) {
+    m_workers.emplace_back(&JobSystem::workerLoop, this, queueIndex);
+  }
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard lock(m_sleepMutex);
+    m_stopping = true;
+  }
+  m_jobsQueued.notify_all();
+
+  for (std::thread &worker : m_workers) {
+    worker.join();
+  }
+}
+
+JobSystem::JobHandle JobSystem::submit(std::function<void()>                  function,
+                                       const std::initializer_list<JobHandle> dependencies,
+                                       const Lane                             lane) {
+  const auto job      = std::make_shared<Job>();
+  job->function       = std::move(function);
+  job->mainThreadOnly = lane == Lane::MAIN_THREAD;
+
+  // The job starts with one pending dependency of its own, released once every real one
+  // has been registered, so it cannot be scheduled halfway through.
+  for (const JobHandle &dependency : dependencies) {
+    if (dependency.m_job == nullptr) {
+      continue;
+    }
+
+    std::lock_guard lock(dependency.m_job->mutex);
+    if (!dependency.m_job->finished.load(std::memory_order_relaxed)) {
+      dependency.m_job->dependents.push_back(job);
+      job->pendingDependencies.fetch_add(1);
+    }
+  }
+
+  JobHandle handle;
+  handle.m_job = job;
+
+  if (job->pendingDependencies.fetch_sub(1) == 1) {
+    schedule(job);
+  }
+  return handle;
+}
+
+void JobSystem::schedule(const std::shared_ptr<Job> &job) {
+  if (m_workers.empty()) {
+    execute(job);
+    return;
+  }
+
+  if (job->mainThreadOnly) {
+    std::lock_guard lock(m_mainThreadQueue.mutex);
+    m_mainThreadQueue.push(job);
+    return;
+  }
+
+  // Threads outside the job system hand their jobs to the creating thread's queue.
+  JobQueue *queue = getOwnQueue();
+  if (queue == nullptr) {
+    queue = m_queues.front().get();
+  }
+
+  {
+    std::lock_guard lock(queue->mutex);
+    queue->push(job);
+  }
+  m_queuedJobs.fetch_add(1);
+
+  {
+    std::lock_guard lock(m_sleepMutex);
+  }
+  m_jobsQueued.notify_one();
+}
+
+void JobSystem::execute(const std::shared_ptr<Job> &job) {
+  job->function();
+  if (!job->reusable) {
+    job->function = nullptr;
+  }
+
+  std::vector<std::shared_ptr<Job>> dependents;
+  {
+    std::lock_guard lock(job->mutex);
+    job->finished.store(true, std::memory_order_release);
+    dependents.swap(job->dependents);
+  }
+
+  for (const std::shared_ptr<Job> &dependent : dependents) {
+    if (dependent->pendingDependencies.fetch_sub(1) == 1) {
+      schedule(dependent);
+    }
+  }
+}
+
+bool JobSystem::runOneJob() {
+  std::shared_ptr<Job> job;
+
+  if (std::this_thread::get_id() == m_mainThreadId) {
+    std::lock_guard lock(m_mainThreadQueue.mutex);
+    job = m_mainThreadQueue.takeOldest();
+  }
+
+  // Newest first from the thread's own queue, then oldest first from the others.
+  JobQueue *ownQueue = getOwnQueue();
+  if (job == nullptr && ownQueue != nullptr) {
+    std::lock_guard lock(ownQueue->mutex);
+    job = ownQueue->takeNewest();
+    if (job != nullptr) {
+      m_queuedJobs.fetch_sub(1);
+    }
+  }
+
+  const size_t firstVictim = ownQueue != nullptr ? t_queueIndex + 1 : 0;
+  for (size_t offset = 0; job == nullptr && offset < m_queues.size(); offset++) {
+    JobQueue &queue = *m_queues[(firstVictim + offset) % m_queues.size()];
+    if (&queue == ownQueue) {
+      continue;
+    }
+
+    std::lock_guard lock(queue.mutex);
+    job = queue.takeOldest();
+    if (job != nullptr) {
+      m_queuedJobs.fetch_sub(1);
+    }
+  }
+
+  if (job == nullptr) {
+    return false;
+  }
+
+  execute(job);
+  return true;
+}
+
+void JobSystem::workerLoop(const size_t queueIndex) {
+  t_jobSystem  = this;
+  t_queueIndex = queueIndex;
+
+  while (true) {
+    if (runOneJob()) {
+      continue;
+    }
+
+    std::unique_lock lock(m_sleepMutex);
+    m_jobsQueued.wait(lock, [this] { return m_stopping || m_queuedJobs.load() > 0; });
+    if (m_stopping) {
+      return;
+    }
+  }
+}
+
+JobSystem::JobQueue *JobSystem::getOwnQueue() {
+  if (std::this_thread::get_id() == m_mainThreadId) {
+    return m_queues.front().get();
+  }
+  if (t_jobSystem == this) {
+    return m_queues[t_queueIndex].get();
+  }
+  return nullptr;
+}
+
+void JobSystem::wait(const JobHandle &handle) {
+  while (!handle.isFinished()) {
+    if (!runOneJob()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::parallelFor(const size_t                               begin,
+                            const size_t                               end,
+                            const size_t                               grainSize,
+                            const std::function<void(size_t, size_t)> &function) {
+  if (end <= begin) {
+    return;
+  }
+
+  const size_t itemCount = end - begin;
+  const size_t chunkSize = getChunkSize(itemCount, grainSize, getThreadCount());
+  if (m_workers.empty() || chunkSize >= itemCount) {
+    function(begin, end);
+    return;
+  }
+
+  const size_t chunksInUse = (itemCount + chunkSize - 1) / chunkSize;
+
+  /*
+   * The caller and the helper jobs claim chunks from a shared counter until none are left,
+   * and the caller then only waits for the chunks still running. Waiting on the helpers with
+   * `wait` instead could run an unrelated job, e.g. a whole simulation step, in the middle of
+   * the loop. Helpers that start after the loop has returned find no chunks left, so the
+   * counters are shared with them rather than kept on the stack.
+   */
+  struct Progress {
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> finishedChunks{0};
+  };
+  const auto progress = std::make_shared<Progress>();
+
+  const auto runChunks = [&function, progress, begin, end, chunkSize, chunksInUse]() -> void {
+    for (size_t chunk = progress->nextChunk.fetch_add(1); chunk < chunksInUse;
+         chunk = progress->nextChunk.fetch_add(1)) {
+      const size_t chunkBegin = begin + chunk * chunkSize;
+      function(chunkBegin, std::min(chunkBegin + chunkSize, end));
+      progress->finishedChunks.fetch_add(1, std::memory_order_release);
+    }
+  };
+
+  const size_t helperCount = std::min(chunksInUse, getThreadCount()) - 1;
+  for (size_t helper = 0; helper < helperCount; helper++) {
+    submit(runChunks);
+  }
+
+  runChunks();
+
+  while (progress->finishedChunks.load(std::memory_order_acquire) < chunksInUse) {
+    std::this_thread::yield();
+  }
+}
+
+JobSystem::ParallelLoop::ParallelLoop(JobSystem                          &jobSystem,
+                                      std::function<void(size_t, size_t)> function) :
+    m_jobSystem(jobSystem), m_function(std::move(function)) {
+  // The thread running the loop takes part itself, so it needs one helper fewer.
+  for (size_t helper = 1; helper < jobSystem.getThreadCount(); helper++) {
+    const auto job = std::make_shared<Job>();
+    job->function  = [this]() -> void { runChunks(); };
+    job->reusable  = true;
+    job->finished.store(true);
+    m_helpers.push_back(job);
+  }
+}
+
+JobSystem::ParallelLoop::~ParallelLoop() {
+  for (const std::shared_ptr<Job> &helper : m_helpers) {
+    while (!helper->finished.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void JobSystem::ParallelLoop::runChunks() {
+  std::uint64_t claims = m_claims.load(std::memory_order_acquire);
+  while (true) {
+    const auto chunk      = static_cast<size_t>(claims & CHUNK_MASK);
+    const auto chunkCount = static_cast<size_t>((claims >> CHUNK_COUNT_SHIFT) & CHUNK_MASK);
+    if (chunk >= chunkCount) {
+      return;
+    }
+
+    // Fails, reloading the counter, if another thread claimed the chunk or a new run began.
+    if (!m_claims.compare_exchange_weak(claims, claims + 1, std::memory_order_acq_rel)) {
+      continue;
+    }
+
+    const size_t chunkBegin = m_begin + chunk * m_chunkSize;
+    m_function(chunkBegin, std::min(chunkBegin + m_chunkSize, m_end));
+    m_finishedChunks.fetch_add(1, std::memory_order_release);
+    claims += 1;
+  }
+}
+
+void JobSystem::ParallelLoop::run(const size_t begin,
+                                  const size_t end,
+                                  const size_t grainSize) {
+  if (end <= begin) {
+    return;
+  }
+
+  const size_t itemCount = end - begin;
+  const size_t chunkSize = getChunkSize(itemCount, grainSize, m_jobSystem.getThreadCount());
+  if (m_helpers.empty() || chunkSize >= itemCount) {
+    m_function(begin, end);
+    return;
+  }
+
+  // The range is only read by threads that claimed a chunk of this run, after publishing it.
+  const size_t chunkCount = (itemCount + chunkSize - 1) / chunkSize;
+  m_begin                 = begin;
+  m_end                   = end;
+  m_chunkSize             = chunkSize;
+  m_run += 1;
+  m_finishedChunks.store(0, std::memory_order_relaxed);
+  m_claims.store(static_cast<std::uint64_t>(m_run) << RUN_SHIFT |
+                     static_cast<std::uint64_t>(chunkCount) << CHUNK_COUNT_SHIFT,
+                 std::memory_order_release);
+
+  const size_t helperCount = std::min(chunkCount - 1, m_helpers.size());
+  for (size_t helper = 0; helper < helperCount; helper++) {
+    Job &job = *m_helpers[helper];
+    if (job.finished.load(std::memory_order_acquire)) {
+      job.finished.store(false, std::memory_order_relaxed);
+      m_jobSystem.schedule(m_helpers[helper]);
+    }
+  }
+
+  runChunks();
+
+  while (m_finishedChunks.load(std::memory_order_acquire) < chunkCount) {
+    std::this_thread::yield();
+  }
+}
+
+void JobSystem::runMainThreadJobs() {
+  while (true) {
+    std::shared_ptr<Job> job;
+    {
+      std::lock_guard lock(m_mainThreadQueue.mutex);
+      job = m_mainThreadQueue.takeOldest();
+    }
+    if (job == nullptr) {
+      return;
+    }
+    execute(job);
+  }
+}
+
+size_t JobSystem::getThreadCount() const {
+  return m_workers.size() + 1;
+}
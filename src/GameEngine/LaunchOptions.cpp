@@ -0,0 +1,42 @@
+#include "../../includes/GameEngine/LaunchOptions.hpp"
+
+#include <SDL2/SDL.h>
+#include <string>
+
+LaunchOptions LaunchOptions::parse(const int argc, char *argv[]) {
+  LaunchOptions options;
+
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    const bool        hasValue = i + 1 < argc;
+
+    if (argument == "--record" && hasValue) {
+      options.recordPath = argv[++i];
+      continue;
+    }
+
+    if (argument == "--replay" && hasValue) {
+      options.replayPath = argv[++i];
+      continue;
+    }
+
+    if (argument == "--telemetry" && hasValue) {
+      options.telemetryPath = argv[++i];
+      continue;
+    }
+
+    if (argument == "--frame-stats" && hasValue) {
+      options.frameStatsPath = argv[++i];
+      continue;
+    }
+
+    if (argument == "--stress" && hasValue) {
+      options.stressReportPath = argv[++i];
+      continue;
+    }
+
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Ignoring argument %s", argument.c_str());
+  }
+
+  return options;
+}
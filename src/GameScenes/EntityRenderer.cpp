@@ -0,0 +1,101 @@
+#include "../../includes/GameScenes/EntityRenderer.hpp"
+
+EntityRenderer::EntityRenderer(SoftwareRenderer *softwareRenderer) :
+    m_batcher(softwareRenderer) {}
+
+void EntityRenderer::build(DrawList           &drawList,
+                           JobSystem          &jobSystem,
+                           const EntityVector &entities,
+                           const std::uint64_t currentTime) {
+  drawList.quads.resize(entities.size());
+
+  const auto buildQuads = [&](const size_t begin, const size_t end) {
+    for (size_t index = begin; index < end; index++) {
+      const std::shared_ptr<Entity> &entity = entities[index];
+      DrawList::Quad                &quad   = drawList.quads[index];
+      const auto                    &cShape = entity->getComponent<CShape>();
+
+      quad.visible = cShape != nullptr;
+      if (!quad.visible) {
+        continue;
+      }
+
+      // Placed from the transform alone, so drawing never writes to the components.
+      const Rect &rect = cShape->rect;
+      const Vec2 &pos  = entity->getComponent<CTransform>()->topLeftCornerPos;
+
+      quad.rect = {
+          .x = static_cast<int>(pos.x),
+          .y = static_cast<int>(pos.y),
+          .w = rect.w,
+          .h = rect.h,
+      };
+
+      const auto &cSprite = entity->getComponent<CSprite>();
+      quad.hasSprite      = cSprite != nullptr;
+      if (quad.hasSprite) {
+        quad.textureName = cSprite->getTextureName();
+        continue;
+      }
+
+      // Everything but enemies fades out over its lifespan.
+      const auto &cLifespan = entity->getComponent<CLifespan>();
+      quad.color            = cShape->color;
+      if (cLifespan != nullptr && entity->tag() != EntityTags::Enemy) {
+        quad.color.a = cLifespan->getFadeAlpha(currentTime);
+      }
+    }
+  };
+
+  constexpr size_t RENDER_GRAIN_SIZE = 128;
+  jobSystem.parallelFor(0, entities.size(), RENDER_GRAIN_SIZE, buildQuads);
+}
+
+void EntityRenderer::draw(SDL_Renderer         *renderer,
+                          const TextureManager &textureManager,
+                          const DrawList       &drawList) {
+  for (const DrawList::Quad &quad : drawList.quads) {
+    if (!quad.visible) {
+      continue;
+    }
+
+    // If there's no sprite, render a plain box
+    if (!quad.hasSprite) {
+      const SDL_Color color = {
+          .r = quad.color.r,
+          .g = quad.color.g,
+          .b = quad.color.b,
+          .a = quad.color.a,
+      };
+      m_batcher.addQuad(quad.rect, color);
+      continue;
+    }
+
+    // Sprites whose image could not be loaded are skipped.
+    const SpriteRegion *region = textureManager.getSpriteRegion(quad.textureName);
+    if (region == nullptr) {
+      continue;
+    }
+
+    constexpr SDL_Color SPRITE_COLOR = {.r = 255, .g = 255, .b = 255, .a = 255};
+    m_batcher.addQuad(quad.rect,
+                      SPRITE_COLOR,
+                      textureManager.getTexture(region->textureIndex),
+                      region->texCoords);
+  }
+
+  m_batcher.flush(renderer);
+}
+
+void EntityRenderer::render(SDL_Renderer         *renderer,
+                            const TextureManager &textureManager,
+                            JobSystem            &jobSystem,
+                            const EntityVector   &entities,
+                            const std::uint64_t   currentTime) {
+  build(m_drawList, jobSystem, entities, currentTime);
+  draw(renderer, textureManager, m_drawList);
+}
+
+size_t EntityRenderer::getDrawCallCount() const {
+  return m_batcher.getDrawCallCount();
+}
@@ -1,30 +1,109 @@
+#include <algorithm>
+#include <cstdio>
 #include <filesystem>
+#include <random>
+#include <utility>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
 #endif
 
 #include "../../../includes/GameScenes/MainScene/MainScene.hpp"
-#include "../../../includes/GameScenes/MainScene/MainSceneSpawner.hpp"
 #include "../../../includes/GameScenes/MenuScene/MenuScene.hpp"
 #include "../../../includes/GameScenes/ScoreScene/ScoreScene.hpp"
-#include "../../../includes/Helpers/CollisionHelpers.hpp"
-#include "../../../includes/Helpers/MovementHelpers.hpp"
-#include "../../../includes/Helpers/SpawnHelpers.hpp"
-#include "../../../includes/Helpers/TextHelpers.hpp"
+#include "../../../includes/Helpers/BinaryIO.hpp"
+#include "../../../includes/Helpers/Profiler.hpp"
 #include "../../../includes/Helpers/Vec2.hpp"
 
+namespace {
+  const Path TRACE_EXPORT_PATH = "yerb-trace.json";
+
+  // Room for every burst of a busy few seconds, with tens of thousands of particles live.
+  constexpr size_t PARTICLE_CAPACITY = 65536;
+
+  /**
+   * The particles thrown out where an event happened, if any.
+   */
+  std::optional<ParticleSystem::Burst> getParticleBurst(const GameEvent &event) {
+    ParticleSystem::Burst burst = {
+        .position    = event.position,
+        .count       = 0,
+        .color       = {.r = 255, .g = 255, .b = 255, .a = 255},
+        .minSpeed    = 60,
+        .maxSpeed    = 240,
+        .minLifetime = 0.3f,
+        .maxLifetime = 0.8f,
+        .size        = 4,
+    };
+
+    switch (event.type) {
+      case GameEventType::SHOOT:
+        return std::nullopt;
+      case GameEventType::BULLET_HIT_ENEMY:
+        burst.count = 48;
+        burst.color = {.r = 255, .g = 170, .b = 60, .a = 255};
+        break;
+      case GameEventType::BULLET_HIT_WALL:
+        burst.count    = 12;
+        burst.color    = {.r = 200, .g = 200, .b = 200, .a = 255};
+        burst.maxSpeed = 120;
+        burst.size     = 3;
+        break;
+      case GameEventType::PLAYER_HIT_ENEMY:
+        burst.count       = 160;
+        burst.color       = {.r = 255, .g = 60, .b = 60, .a = 255};
+        burst.maxSpeed    = 400;
+        burst.maxLifetime = 1.2f;
+        break;
+      case GameEventType::SLOWNESS_ACQUIRED:
+        burst.count = 64;
+        burst.color = {.r = 180, .g = 80, .b = 255, .a = 255};
+        break;
+      case GameEventType::SPEED_BOOST_ACQUIRED:
+        burst.count = 64;
+        burst.color = {.r = 80, .g = 255, .b = 120, .a = 255};
+        break;
+      case GameEventType::ITEM_ACQUIRED:
+        burst.count = 96;
+        burst.color = {.r = 255, .g = 230, .b = 80, .a = 255};
+        break;
+    }
+    return burst;
+  }
+} // namespace
+
 MainScene::MainScene(GameEngine *gameEngine) :
     Scene(gameEngine),
-    m_entities(EntityManager()),
-    m_spawner(m_randomGenerator,
-              gameEngine->getConfigManager(),
-              gameEngine->getTextureManager(),
-              m_entities,
-              gameEngine->getVideoManager().getRenderer()) {
-  m_player = m_spawner.spawnPlayer();
-  std::cout << "spawned the player" << std::endl;
-  m_spawner.spawnWalls();
+    m_lastFrameTime(SDL_GetTicks64()),
+    m_lastFrameCounter(SDL_GetPerformanceCounter()),
+    m_replayRecording(loadReplayRecording(gameEngine)),
+    m_seed(m_replayRecording.has_value() ? m_replayRecording->seed : std::random_device()()),
+    m_simulation(gameEngine->getConfigManager(), m_seed),
+    m_rewindBuffer(gameEngine->getConfigManager().getRewindConfig().memoryBudget,
+                   gameEngine->getConfigManager().getRewindConfig().keyframeInterval),
+    m_spawnBudgetController(gameEngine->getConfigManager().getSpawnBudgetConfig()),
+    m_entityRenderer(gameEngine->getVideoManager().getSoftwareRenderer()),
+    m_particles(PARTICLE_CAPACITY),
+    m_particleRenderer(gameEngine->getVideoManager().getSoftwareRenderer()) {
+  const LaunchOptions &launchOptions = gameEngine->getLaunchOptions();
+  const GameConfig    &gameConfig    = gameEngine->getConfigManager().getGameConfig();
+
+  m_simulation.setJobSystem(&gameEngine->getJobSystem());
+  m_rewindBuffer.record(m_simulation);
+
+  if (m_replayRecording.has_value()) {
+    m_replayer = std::make_unique<InputReplayer>(*m_replayRecording);
+  } else if (launchOptions.recordPath.has_value()) {
+    m_recorder = std::make_unique<InputRecorder>(m_seed, gameConfig.windowSize);
+  }
+
+  if (launchOptions.telemetryPath.has_value()) {
+    try {
+      m_telemetry = std::make_unique<TelemetryLogWriter>(*launchOptions.telemetryPath);
+    } catch (const BinaryFormatError &error) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not log telemetry: %s", error.what());
+    }
+  }
 
   // WASD
   registerAction(SDLK_w, "FORWARD");
@@ -37,117 +116,282 @@ MainScene::MainScene(GameEngine *gameEngine) :
   // Pause
   registerAction(SDLK_p, "PAUSE");
 
+  // Rewind
+  registerAction(SDLK_LEFT, "STEP_BACK");
+  registerAction(SDLK_r, "REWIND");
+
   // Go to menu
   registerAction(SDLK_BACKSPACE, "GO_BACK");
+
+  // Profiler
+  registerAction(SDLK_F3, "TOGGLE_PROFILER");
+  registerAction(SDLK_F9, "EXPORT_TRACE");
+
+  // The first frame draws the simulation's initial state.
+  buildDrawList(m_drawList);
+}
+
+std::optional<InputRecording> MainScene::loadReplayRecording(GameEngine *gameEngine) {
+  const std::optional<Path> &replayPath = gameEngine->getLaunchOptions().replayPath;
+  if (!replayPath.has_value()) {
+    return std::nullopt;
+  }
+
+  try {
+    InputRecording recording = InputRecording::load(*replayPath);
+    gameEngine->getConfigManager().updateGameWindowSize(recording.windowSize);
+    SDL_Log("Replaying %s", replayPath->string().c_str());
+    return recording;
+  } catch (const std::runtime_error &error) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not load replay: %s", error.what());
+    return std::nullopt;
+  }
 }
 
 void MainScene::update() {
-  const Uint64 currentTime = SDL_GetTicks64();
-  m_deltaTime              = static_cast<float>(currentTime - m_lastFrameTime) / 1000.0f;
+  PROFILE_ZONE("MainScene::update");
+  if (m_profilerStatistics.has_value()) {
+    m_profilerStatistics->update();
+  }
+
+  const Uint64 currentTime  = SDL_GetTicks64();
+  const Uint64 deltaTime    = currentTime - m_lastFrameTime;
+  const Uint64 tickDuration = m_replayRecording.has_value()
+                                  ? m_replayRecording->tickDuration
+                                  : MainSceneSimulation::TICK_DURATION;
+
+  const Uint64        frameCounter = SDL_GetPerformanceCounter();
+  const std::uint32_t frameTime =
+      GameEngine::toMicroseconds(frameCounter - m_lastFrameCounter);
+
+  // Recorded window resizes write to the configuration, which the job reads, so they and the
+  // recorded spawn budget changes are applied here, before it starts.
+  if (m_replayer != nullptr) {
+    m_replayer->applyConfigActions(m_simulation, m_gameEngine->getConfigManager());
+  }
+
+  // Until the job has been waited on it owns the simulation and the next draw list; the
+  // main thread only reads the current draw list meanwhile.
+  JobSystem                 &jobSystem     = m_gameEngine->getJobSystem();
+  const Uint64               workStart     = SDL_GetPerformanceCounter();
+  const JobSystem::JobHandle simulationJob = jobSystem.submit(
+      [this, deltaTime, tickDuration, frameTime]() -> void {
+        stepSimulation(deltaTime, tickDuration, frameTime);
+        updateParticles(deltaTime);
+        buildDrawList(m_nextDrawList);
+        m_simulationEnd = SDL_GetPerformanceCounter();
+      });
+
+  sRender();
 
-  if (!m_paused && !m_gameOver) {
-    sMovement();
-    sCollision();
-    sSpawner();
-    sLifespan();
-    sEffects();
-    sTimer();
+  {
+    PROFILE_ZONE("waitForSimulation");
+    jobSystem.wait(simulationJob);
+  }
+  std::swap(m_drawList, m_nextDrawList);
+
+  if (m_simulation.isGameOver()) {
+    m_endTriggered = true;
   }
 
   sAudio();
-  sRender();
-  m_lastFrameTime = currentTime;
+
+  /*
+   * The job and the drawing run side by side when there are workers, and one after the
+   * other when the job ran inline, so the frame's work lasts until whichever ended last.
+   * A replay applies the recorded budget, and a paused simulation has no load to shed.
+   */
+  if (!m_paused && m_replayer == nullptr) {
+    const Uint64 workEnd = std::max(m_simulationEnd, m_renderEnd);
+    updateSpawnBudget(GameEngine::toMicroseconds(workEnd - workStart));
+  }
+
+  m_lastFrameTime    = currentTime;
+  m_lastFrameCounter = frameCounter;
 
   if (m_endTriggered) {
     onEnd();
   }
 }
 
-void MainScene::sDoAction(Action &action) {
-  if (m_player == nullptr) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Player entity is null, cannot process action.");
+void MainScene::stepSimulation(const Uint64        deltaTime,
+                               const Uint64        tickDuration,
+                               const std::uint32_t frameTime) {
+  PROFILE_ZONE("stepSimulation");
+
+  // Caps how much simulation time a single slow frame can catch up on.
+  constexpr Uint64 MAX_CATCH_UP_TIME = 250;
+
+  if (m_paused) {
     return;
   }
 
-  const ActionState &actionState      = action.getState();
-  AudioSampleQueue  &audioSampleQueue = m_gameEngine->getAudioSampleQueue();
+  m_tickAccumulator = std::min(m_tickAccumulator + deltaTime, MAX_CATCH_UP_TIME);
+
+  while (m_tickAccumulator >= tickDuration && !m_simulation.isGameOver()) {
+    if (m_replayer != nullptr) {
+      if (m_replayer->isFinished(m_simulation)) {
+        m_endTriggered = true;
+        break;
+      }
+      // A pending resize or spawn budget change holds the tick back until the next frame.
+      if (!m_replayer->applyActions(m_simulation)) {
+        break;
+      }
+    }
+
+    const Uint64 updateStart = SDL_GetPerformanceCounter();
+    m_simulation.update(tickDuration);
+    const Uint64 updateEnd = SDL_GetPerformanceCounter();
+
+    const std::uint32_t updateTime = GameEngine::toMicroseconds(updateEnd - updateStart);
+    m_rewindBuffer.record(m_simulation);
+    if (m_telemetry != nullptr) {
+      m_telemetry->write(TelemetryRow::capture(m_simulation, frameTime, updateTime));
+    }
+    m_tickAccumulator -= tickDuration;
+  }
+}
+
+void MainScene::updateParticles(const Uint64 deltaTime) {
+  PROFILE_ZONE("updateParticles");
+  if (!m_paused) {
+    m_particles.update(static_cast<float>(deltaTime) / 1000.0f);
+  }
+
+  for (const GameEvent &event : m_simulation.getEvents()) {
+    const std::optional<ParticleSystem::Burst> burst = getParticleBurst(event);
+    if (burst.has_value()) {
+      m_particles.emit(*burst);
+    }
+  }
+}
+
+void MainScene::sDoAction(Action &action) {
+  AudioSampleQueue &audioSampleQueue = m_gameEngine->getAudioSampleQueue();
 
-  const auto &cInput = m_player->getComponent<CInput>();
+  if (action.getState() == ActionState::START && action.getName() == "PAUSE") {
+    audioSampleQueue.queueSample(AudioSample::MENU_SELECT, AudioSamplePriority::CRITICAL);
+    m_paused = !m_paused;
+    return;
+  }
 
-  if (cInput == nullptr) {
-    SDL_LogError(SDL_LOG_CATEGORY_ERROR, "Player entity lacks an input component.");
+  if (action.getState() == ActionState::START && action.getName() == "GO_BACK") {
+    audioSampleQueue.queueSample(AudioSample::MENU_SELECT, AudioSamplePriority::CRITICAL);
+    m_endTriggered = true;
     return;
   }
 
-  bool &forward  = cInput->forward;
-  bool &backward = cInput->backward;
-  bool &left     = cInput->left;
-  bool &right    = cInput->right;
+  if (action.getState() == ActionState::START && action.getName() == "TOGGLE_PROFILER") {
+    if (m_profilerStatistics.has_value()) {
+      m_profilerStatistics.reset();
+    } else {
+      m_profilerStatistics.emplace();
+    }
+    return;
+  }
 
-  const bool actionStateStart = actionState == ActionState::START;
+  if (action.getState() == ActionState::START && action.getName() == "EXPORT_TRACE") {
+    try {
+      const size_t zoneCount = Profiler::exportChromeTrace(TRACE_EXPORT_PATH);
+      SDL_Log("Exported %zu profiler zones to %s", zoneCount, TRACE_EXPORT_PATH.c_str());
+    } catch (const std::runtime_error &error) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not export trace: %s", error.what());
+    }
+    return;
+  }
 
-  if (action.getName() == "FORWARD") {
-    forward = actionStateStart;
+  if (action.getState() == ActionState::START && action.getName() == "STEP_BACK") {
+    rewind(1);
+    return;
   }
-  if (action.getName() == "BACKWARD") {
-    backward = actionStateStart;
+
+  if (action.getState() == ActionState::START && action.getName() == "REWIND") {
+    rewind(1000 / MainSceneSimulation::TICK_DURATION);
+    return;
   }
-  if (action.getName() == "LEFT") {
-    left = actionStateStart;
+
+  // During a replay the recorded input drives the simulation.
+  if (m_paused || m_replayer != nullptr) {
+    return;
   }
-  if (action.getName() == "RIGHT") {
-    right = actionStateStart;
+
+  if (m_recorder != nullptr) {
+    m_recorder->record(m_simulation, action);
   }
 
-  if (!actionStateStart) {
+  m_simulation.sDoAction(action);
+}
+
+void MainScene::rewind(const std::uint64_t ticks) {
+  if (!m_rewindBuffer.stepBack(m_simulation, ticks)) {
     return;
   }
-  if (action.getName() == "SHOOT") {
-    const auto currentTime = SDL_GetTicks64();
-    const auto spawnBullet = currentTime - m_lastBulletSpawnTime > m_bulletSpawnCooldown;
-    if (!spawnBullet) {
-      return;
-    }
 
-    const std::optional<Vec2> position = action.getPos();
-    if (!position.has_value()) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM, "A mouse event was called without a position.");
-      return;
-    }
-    const Vec2 mousePosition = *position;
+  m_paused          = true;
+  m_tickAccumulator = 0;
+  m_particles.clear();
 
-    audioSampleQueue.queueSample(AudioSample::SHOOT, AudioSamplePriority::STANDARD);
-    m_spawner.spawnBullets(m_player, mousePosition);
-    m_lastBulletSpawnTime = currentTime;
+  // The restored state is the end of a tick, so input from that tick on is in the future.
+  const std::uint64_t tick = m_simulation.getTick();
+  if (m_recorder != nullptr) {
+    m_recorder->discardFrom(tick);
 
-    if (action.getName() == "PAUSE") {
-      audioSampleQueue.queueSample(AudioSample::MENU_SELECT, AudioSamplePriority::CRITICAL);
-      m_paused = !m_paused;
+    // Resizes after the restored tick went with the rest, but the window kept its size, so
+    // it is recorded again and the restored walls are placed for it, as a replay will.
+    const Vec2 &windowSize = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+    if (m_recorder->getWindowSize() != windowSize) {
+      m_recorder->recordWindowResize(m_simulation, windowSize);
+      m_simulation.onWindowResize();
     }
   }
+  if (m_replayer != nullptr) {
+    m_replayer->seek(tick);
+  }
+}
 
-  if (action.getName() == "GO_BACK") {
-    audioSampleQueue.queueSample(AudioSample::MENU_SELECT, AudioSamplePriority::CRITICAL);
-    m_endTriggered = true;
+void MainScene::updateSpawnBudget(const std::uint32_t frameCost) {
+  const std::optional<MainSceneSimulation::SpawnBudget> spawnBudget =
+      m_spawnBudgetController.update(static_cast<float>(frameCost) / 1000.0f,
+                                     m_simulation.getEntityManager());
+  if (!spawnBudget.has_value() || *spawnBudget == m_simulation.getSpawnBudget()) {
+    return;
   }
+
+  if (m_recorder != nullptr) {
+    m_recorder->recordSpawnBudget(m_simulation, *spawnBudget);
+  }
+  m_simulation.setSpawnBudget(*spawnBudget);
+
+  SDL_Log("Spawn budget %u%%, culling %u (frame cost %.2f ms)",
+          static_cast<unsigned int>(spawnBudget->spawnPercentage),
+          static_cast<unsigned int>(spawnBudget->cullCount),
+          static_cast<double>(m_spawnBudgetController.getMetrics().frameCost));
 }
 
-void MainScene::renderText() const {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font     *fontSm   = m_gameEngine->getFontManager().getFontSm();
-  TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
+void MainScene::buildDrawList(DrawList &drawList) {
+  PROFILE_ZONE("buildDrawList");
+  EntityRenderer::build(drawList,
+                        m_gameEngine->getJobSystem(),
+                        m_simulation.getEntityManager().getEntities(),
+                        m_simulation.getCurrentTime());
+  ParticleRenderer::build(drawList, m_gameEngine->getJobSystem(), m_particles);
+
+  const TTF_Font *fontSm = m_gameEngine->getFontManager().getFontSm();
+  const TTF_Font *fontMd = m_gameEngine->getFontManager().getFontMd();
+  drawList.textRuns.clear();
 
   constexpr SDL_Color scoreColor = {255, 255, 255, 255};
-  const std::string   scoreText  = "Score: " + std::to_string(m_score);
+  const std::string   scoreText  = "Score: " + std::to_string(m_simulation.getScore());
   const Vec2          scorePos   = {10, 10};
-  TextHelpers::renderLineOfText(renderer, fontMd, scoreText, scoreColor, scorePos);
+  drawList.textRuns.push_back({fontMd, scoreText, scoreColor, scorePos});
 
   constexpr SDL_Color livesColor = {255, 255, 255, 255};
-  const std::string   livesText  = "Lives: " + std::to_string(m_lives);
+  const std::string   livesText  = "Lives: " + std::to_string(m_simulation.getLives());
   const Vec2          livesPos   = {10, 40};
-  TextHelpers::renderLineOfText(renderer, fontMd, livesText, livesColor, livesPos);
+  drawList.textRuns.push_back({fontMd, livesText, livesColor, livesPos});
 
-  const Uint64        timeRemaining = m_timeRemaining;
+  const Uint64        timeRemaining = m_simulation.getTimeRemaining();
   const Uint64        minutes       = timeRemaining / 60000;
   const Uint64        seconds       = timeRemaining % 60000 / 1000;
   constexpr SDL_Color timeColor     = {255, 255, 255, 255};
@@ -155,293 +399,134 @@ void MainScene::renderText() const {
                                (seconds < 10 ? "0" : "") + std::to_string(seconds);
   const Vec2 timePos = {10, 70};
 
-  TextHelpers::renderLineOfText(renderer, fontMd, timeText, timeColor, timePos);
+  drawList.textRuns.push_back({fontMd, timeText, timeColor, timePos});
 
-  const auto cEffects = m_player->getComponent<CEffects>();
+  const auto cEffects = m_simulation.getPlayer()->getComponent<CEffects>();
 
   if (cEffects->hasEffect(Speed)) {
     constexpr SDL_Color speedBoostColor = {0, 255, 0, 255};
     const std::string   speedBoostText  = "Speed Boost Active!";
     const Vec2          speedBoostPos   = {10, 120};
-    TextHelpers::renderLineOfText(
-        renderer, fontSm, speedBoostText, speedBoostColor, speedBoostPos);
+    drawList.textRuns.push_back({fontSm, speedBoostText, speedBoostColor, speedBoostPos});
   }
 
   if (cEffects->hasEffect(Slowness)) {
     constexpr SDL_Color slownessColor = {255, 0, 0, 255};
     const std::string   slownessText  = "Slowness Active!";
     const Vec2          slownessPos   = {10, 120};
-    TextHelpers::renderLineOfText(renderer, fontSm, slownessText, slownessColor, slownessPos);
+    drawList.textRuns.push_back({fontSm, slownessText, slownessColor, slownessPos});
   }
 }
 
-void MainScene::sRender() {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-
-  if (m_entities.getEntities().empty()) {
-    std::cout << "no entities\n";
-  }
-
-  for (const auto &entity : m_entities.getEntities()) {
-    const auto &cShape     = entity->getComponent<CShape>();
-    const auto &cTransform = entity->getComponent<CTransform>();
-
-    if (cShape == nullptr) {
-      continue;
-    }
-
-    SDL_Rect   &rect = cShape->rect;
-    const Vec2 &pos  = cTransform->topLeftCornerPos;
-
-    rect.x = static_cast<int>(pos.x);
-    rect.y = static_cast<int>(pos.y);
-
-    // If there's no sprite, render a plain box
-    if (!entity->hasComponent<CSprite>()) {
-      SDL_SetRenderDrawColor(
-          renderer, cShape->color.r, cShape->color.g, cShape->color.b, cShape->color.a);
-      SDL_RenderFillRect(renderer, &rect);
-      continue; // continue on, render the next entity
-    }
-
-    const auto  &cSprite = entity->getComponent<CSprite>();
-    SDL_Texture *texture = cSprite->getTexture();
-    // ensure that the texture is not a nullptr
-    if (!texture) {
-      continue;
-    }
-
-    SDL_RenderCopy(renderer, texture, nullptr, &rect);
-  }
-
-  renderText();
-  // Update the screen
-  SDL_RenderPresent(renderer);
+void MainScene::renderProfilerOverlay() const {
+  TextRenderer &textRenderer = m_gameEngine->getTextRenderer();
+  TTF_Font     *fontSm       = m_gameEngine->getFontManager().getFontSm();
+  const Vec2   &windowSize   = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+
+  constexpr SDL_Color overlayColor  = {255, 255, 0, 255};
+  constexpr float     OVERLAY_WIDTH = 300;
+  constexpr float     LINE_HEIGHT   = 18;
+
+  Vec2 linePos = {windowSize.x - OVERLAY_WIDTH, 10};
+  textRenderer.renderLine(fontSm, "zone: avg / max ms", overlayColor, linePos);
+
+  std::array<char, 96> line{};
+  for (const auto &summary : m_profilerStatistics->getSummaries()) {
+    std::snprintf(line.data(),
+                  line.size(),
+                  "%.*s: %.2f / %.2f",
+                  static_cast<int>(summary.name.size()),
+                  summary.name.data(),
+                  static_cast<double>(summary.averageTime),
+                  static_cast<double>(summary.maxTime));
+
+    linePos.y += LINE_HEIGHT;
+    textRenderer.renderLine(fontSm, line.data(), overlayColor, linePos);
+  }
+
+  const std::string drawCallsText =
+      "entity draw calls: " + std::to_string(m_entityRenderer.getDrawCallCount());
+  linePos.y += LINE_HEIGHT;
+  textRenderer.renderLine(fontSm, drawCallsText, overlayColor, linePos);
+
+  const std::string particlesText =
+      "particles: " + std::to_string(m_drawList.particleVertices.size() / 4);
+  linePos.y += LINE_HEIGHT;
+  textRenderer.renderLine(fontSm, particlesText, overlayColor, linePos);
 }
 
-void MainScene::sCollision() {
-  using namespace CollisionHelpers::MainScene;
-  const ConfigManager &configManager = m_gameEngine->getConfigManager();
-  const Vec2          &windowSize    = configManager.getGameConfig().windowSize;
-
-  AudioSampleQueue &audioSampleManager = m_gameEngine->getAudioSampleQueue();
-  const GameState   gameState          = {
-                 .entityManager      = m_entities,
-                 .randomGenerator    = m_randomGenerator,
-                 .score              = m_score,
-                 .setScore           = [this](const int score) -> void { setScore(score); },
-                 .decrementLives     = [this]() -> void { decrementLives(); },
-                 .audioSampleManager = audioSampleManager,
-                 .windowSize         = windowSize,
-  };
-
-  for (auto &entity : m_entities.getEntities()) {
-    handleEntityBounds(entity, windowSize);
-    for (auto &otherEntity : m_entities.getEntities()) {
-      const CollisionPair collisionPair = {.entityA = entity, .entityB = otherEntity};
-      handleEntityEntityCollision(collisionPair, gameState);
+void MainScene::sRender() {
+  PROFILE_ZONE("sRender");
+  VideoManager &videoManager = m_gameEngine->getVideoManager();
+  SDL_Renderer *renderer     = videoManager.getRenderer();
+  videoManager.clear({.r = 0, .g = 0, .b = 0, .a = 255});
+
+  m_entityRenderer.draw(renderer, m_gameEngine->getTextureManager(), m_drawList);
+  m_particleRenderer.draw(renderer, m_drawList);
+
+  TextRenderer &textRenderer = m_gameEngine->getTextRenderer();
+  {
+    PROFILE_ZONE("renderText");
+    for (const DrawList::TextRun &textRun : m_drawList.textRuns) {
+      textRenderer.renderLine(textRun.font, textRun.text, textRun.color, textRun.position);
     }
+    textRenderer.flush();
   }
+  videoManager.finishFrame();
 
-  m_entities.update();
-}
-
-void MainScene::sMovement() {
-  const ConfigManager        &configManager          = m_gameEngine->getConfigManager();
-  const PlayerConfig         &playerConfig           = configManager.getPlayerConfig();
-  const EnemyConfig          &enemyConfig            = configManager.getEnemyConfig();
-  const SlownessEffectConfig &slownessEffectConfig   = configManager.getSlownessEffectConfig();
-  const SpeedEffectConfig    &speedBoostEffectConfig = configManager.getSpeedEffectConfig();
-
-  for (const std::shared_ptr<Entity> &entity : m_entities.getEntities()) {
-    MovementHelpers::moveSpeedBoosts(entity, speedBoostEffectConfig, m_deltaTime);
-    MovementHelpers::moveEnemies(entity, enemyConfig, m_deltaTime);
-    MovementHelpers::movePlayer(entity, playerConfig, m_deltaTime);
-    MovementHelpers::moveSlownessDebuffs(entity, slownessEffectConfig, m_deltaTime);
-    MovementHelpers::moveBullets(entity, m_deltaTime);
-    MovementHelpers::moveItems(entity, m_deltaTime);
-  }
-}
-
-void MainScene::sSpawner() {
-  const ConfigManager &configManager  = m_gameEngine->getConfigManager();
-  const Uint64         ticks          = SDL_GetTicks64();
-  const Uint64         SPAWN_INTERVAL = configManager.getGameConfig().spawnInterval;
-
-  if (ticks - m_lastNonPlayerEntitySpawnTime < SPAWN_INTERVAL) {
-    return;
-  }
-
-  m_lastNonPlayerEntitySpawnTime = ticks;
-
-  std::mt19937 &randomGenerator = m_randomGenerator;
-
-  const EnemyConfig          &enemyCfg       = configManager.getEnemyConfig();
-  const SpeedEffectConfig    &speedEffectCfg = configManager.getSpeedEffectConfig();
-  const SlownessEffectConfig &slowEffectCfg  = configManager.getSlownessEffectConfig();
-  const ItemConfig           &itemCfg        = configManager.getItemConfig();
-
-  const auto &cEffects           = m_player->getComponent<CEffects>();
-  const bool hasSpeedBasedEffect = cEffects->hasEffect(Speed) || cEffects->hasEffect(Slowness);
-
-  std::uniform_int_distribution<unsigned int> distribution(0, 100);
-
-  auto shouldSpawn = [&randomGenerator, &distribution](const unsigned int chance) -> bool {
-    return distribution(randomGenerator) < chance;
-  };
-
-  const bool spawnEnemy = shouldSpawn(enemyCfg.spawnPercentage);
-  const bool spawnSpeedBoost =
-      !hasSpeedBasedEffect && shouldSpawn(speedEffectCfg.spawnPercentage);
-  const bool spawnSlowDebuff =
-      !hasSpeedBasedEffect && shouldSpawn(slowEffectCfg.spawnPercentage);
-  const bool spawnItem = shouldSpawn(itemCfg.spawnPercentage);
-
-  if (spawnEnemy) {
-    m_spawner.spawnEnemy(m_player);
-  }
+  // Presenting may wait for the display, which is not work the spawn budget can shed.
+  m_renderEnd = SDL_GetPerformanceCounter();
 
-  if (spawnSpeedBoost) {
-    m_spawner.spawnSpeedBoostEntity(m_player);
+  if (m_profilerStatistics.has_value()) {
+    renderProfilerOverlay();
+    textRenderer.flush();
   }
 
-  if (spawnSlowDebuff) {
-    m_spawner.spawnSlownessEntity(m_player);
-  }
-
-  if (spawnItem) {
-    m_spawner.spawnItem(m_player);
-  }
-}
-
-void MainScene::sEffects() const {
-  const auto               &cEffects = m_player->getComponent<CEffects>();
-  const std::vector<Effect> effects  = cEffects->getEffects();
-  if (effects.empty()) {
-    return;
-  }
-
-  const Uint64 currentTime = SDL_GetTicks64();
-  for (const auto &[startTime, duration, type] : effects) {
-    const bool effectExpired = currentTime - startTime > duration;
-    if (!effectExpired) {
-      return;
-    }
-
-    cEffects->removeEffect(type);
-  }
+  // Update the screen
+  PROFILE_ZONE("present");
+  videoManager.present();
 }
 
-void MainScene::sTimer() {
-  const Uint64 currentTime = SDL_GetTicks64();
-
-  // Check if the timer was recently operated by comparing the current time
-  // with the last frame time and the scene's start time.
-  const bool   wasTimerRecentlyOperated = currentTime - m_lastFrameTime < m_SceneStartTime;
-  const Uint64 elapsedTime = !wasTimerRecentlyOperated ? 0 : currentTime - m_lastFrameTime;
-
-  if (m_timeRemaining < elapsedTime) {
-    m_timeRemaining = 0;
-    setGameOver();
+void MainScene::saveRecording() {
+  const std::optional<Path> &recordPath = m_gameEngine->getLaunchOptions().recordPath;
+  if (m_recorder == nullptr || !recordPath.has_value()) {
     return;
   }
 
-  m_timeRemaining -= elapsedTime;
-}
-
-void MainScene::sLifespan() {
-  for (const auto &entity : m_entities.getEntities()) {
-    const auto tag = entity->tag();
-    if (tag == EntityTags::Player) {
-      continue;
-    }
-    if (tag == EntityTags::Wall) {
-      continue;
-    }
-
-    const auto &cLifespan = entity->getComponent<CLifespan>();
+  m_recorder->finish(m_simulation);
 
-    const auto &cShape = entity->getComponent<CShape>();
-    if (cLifespan == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR,
-                   "Entity with ID %zu and tag %d lacks a lifespan component.",
-                   entity->id(),
-                   tag);
-      continue;
-    }
-
-    if (cShape == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_ERROR,
-                   "Entity with ID %zu and tag %d lacks a shape component.",
-                   entity->id(),
-                   tag);
-      continue;
-    }
-
-    const Uint64 currentTime = SDL_GetTicks();
-    const Uint64 elapsedTime = currentTime - cLifespan->birthTime;
-    // Calculate the lifespan percentage, ensuring it's clamped between 0 and 1
-    const float lifespanPercentage = std::min(
-        1.0f, static_cast<float>(elapsedTime) / static_cast<float>(cLifespan->lifespan));
-
-    const bool entityExpired = elapsedTime > cLifespan->lifespan;
-    if (!entityExpired && entity->tag() == EntityTags::Enemy) {
-      continue;
-    }
-    if (!entityExpired) {
-      constexpr float MAX_COLOR_VALUE = 255.0f;
-      const Uint8     alpha           = static_cast<Uint8>(std::max(
-          0.0f, std::min(MAX_COLOR_VALUE, MAX_COLOR_VALUE * (1.0f - lifespanPercentage))));
-
-      SDL_Color &color = cShape->color;
-      color            = {.r = color.r, .g = color.g, .b = color.b, .a = alpha};
-
-      continue;
-    }
-
-    entity->destroy();
-  }
-}
-
-void MainScene::setGameOver() {
-  if (m_gameOver) {
-    return;
+  try {
+    m_recorder->getRecording().save(*recordPath);
+    SDL_Log("Saved input recording to %s", recordPath->string().c_str());
+  } catch (const BinaryFormatError &error) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not save recording: %s", error.what());
   }
-  m_gameOver     = true;
-  m_endTriggered = true;
 }
 
-void MainScene::setScore(const int score) {
-  m_score = score;
-  if (m_score < 0) {
-    m_score = 0;
-    setGameOver();
-  }
-}
-
-int MainScene::getScore() const {
-  return m_score;
-}
+void MainScene::onEnd() {
+  saveRecording();
 
-void MainScene::decrementLives() {
-  if (m_lives > 0) {
-    m_lives--;
-    return;
+  if (m_replayRecording.has_value()) {
+    const RecordingSummary expected = m_replayRecording->summary;
+    const RecordingSummary actual   = RecordingSummary::capture(m_simulation);
+    SDL_Log("Replay %s: tick %llu, score %d, lives %d, entities %llu",
+            actual == expected ? "matched the recording" : "diverged from the recording",
+            static_cast<unsigned long long>(actual.tickCount),
+            actual.score,
+            actual.lives,
+            static_cast<unsigned long long>(actual.entityCount));
   }
-  setGameOver();
-}
 
-void MainScene::onEnd() {
-  if (!m_gameOver) {
+  if (!m_simulation.isGameOver()) {
     m_gameEngine->loadScene("Menu", std::make_shared<MenuScene>(m_gameEngine));
     return;
   }
-  m_gameEngine->loadScene("ScoreScene", std::make_shared<ScoreScene>(m_gameEngine, m_score));
+  m_gameEngine->loadScene("ScoreScene",
+                          std::make_shared<ScoreScene>(m_gameEngine, m_simulation.getScore()));
 }
 
 void MainScene::sAudio() {
+  PROFILE_ZONE("sAudio");
   AudioManager     &audioManager     = m_gameEngine->getAudioManager();
   AudioSampleQueue &audioSampleQueue = m_gameEngine->getAudioSampleQueue();
 
@@ -449,16 +534,51 @@ void MainScene::sAudio() {
     audioManager.playTrack(AudioTrack::PLAY, -1);
   }
 
+  for (const GameEvent &event : m_simulation.getEvents()) {
+    switch (event.type) {
+      case GameEventType::SHOOT:
+        audioSampleQueue.queueSample(AudioSample::SHOOT, AudioSamplePriority::STANDARD);
+        break;
+      case GameEventType::BULLET_HIT_ENEMY:
+        audioSampleQueue.queueSample(AudioSample::BULLET_HIT_02,
+                                     AudioSamplePriority::STANDARD);
+        break;
+      case GameEventType::BULLET_HIT_WALL:
+        audioSampleQueue.queueSample(AudioSample::BULLET_HIT_01,
+                                     AudioSamplePriority::BACKGROUND);
+        break;
+      case GameEventType::PLAYER_HIT_ENEMY:
+        audioSampleQueue.queueSample(AudioSample::ENEMY_COLLISION,
+                                     AudioSamplePriority::STANDARD);
+        break;
+      case GameEventType::SLOWNESS_ACQUIRED:
+        audioSampleQueue.queueSample(AudioSample::SLOWNESS_DEBUFF,
+                                     AudioSamplePriority::STANDARD);
+        break;
+      case GameEventType::SPEED_BOOST_ACQUIRED:
+        audioSampleQueue.queueSample(AudioSample::SPEED_BOOST, AudioSamplePriority::STANDARD);
+        break;
+      case GameEventType::ITEM_ACQUIRED:
+        audioSampleQueue.queueSample(AudioSample::ITEM_ACQUIRED,
+                                     AudioSamplePriority::STANDARD);
+        break;
+    }
+  }
+  m_simulation.clearEvents();
+
   audioSampleQueue.update();
 }
 
 void MainScene::onSceneWindowResize() {
-  const auto walls = m_entities.getEntities(EntityTags::Wall);
-  for (const auto &wall : walls) {
-    wall->destroy();
+  // A replay restores the recorded window bounds itself.
+  if (m_replayer != nullptr) {
+    return;
   }
 
-  m_entities.update();
+  if (m_recorder != nullptr) {
+    const Vec2 &windowSize = m_gameEngine->getConfigManager().getGameConfig().windowSize;
+    m_recorder->recordWindowResize(m_simulation, windowSize);
+  }
 
-  m_spawner.spawnWalls();
+  m_simulation.onWindowResize();
 }
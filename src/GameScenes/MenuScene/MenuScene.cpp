@@ -1,12 +1,14 @@
 #include "../../../includes/GameScenes/MenuScene/MenuScene.hpp"
 #include "../../../includes/GameScenes/HowToPlayScene/HowToPlayScene.hpp"
 #include "../../../includes/GameScenes/MainScene/MainScene.hpp"
-#include "../../../includes/Helpers/TextHelpers.hpp"
+#include "../../../includes/GameScenes/StressScene/StressScene.hpp"
 
 #include <SDL2/SDL.h>
 
 MenuScene::MenuScene(GameEngine *gameEngine) :
-    Scene(gameEngine) {
+    Scene(gameEngine),
+    m_renderCache(gameEngine->getVideoManager().getRenderer(),
+                  gameEngine->getVideoManager().getSoftwareRenderer()) {
   m_selectedIndex = 0;
   registerAction(SDLK_RETURN, "SELECT");
   registerAction(SDLK_w, "UP");
@@ -31,6 +33,9 @@ void MenuScene::onEnd() {
       m_gameEngine->loadScene("HowToPlay", std::make_shared<HowToPlayScene>(m_gameEngine));
       break;
     case 2:
+      m_gameEngine->loadScene("Stress", std::make_shared<StressScene>(m_gameEngine));
+      break;
+    case 3:
       m_gameEngine->quit();
       break;
     default:;
@@ -38,15 +43,17 @@ void MenuScene::onEnd() {
 }
 
 void MenuScene::sRender() {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-  renderText();
-  SDL_RenderPresent(renderer);
+  VideoManager &videoManager = m_gameEngine->getVideoManager();
+  m_renderCache.render([this, &videoManager]() -> void {
+    videoManager.clear({.r = 0, .g = 0, .b = 0, .a = 255});
+    renderText();
+    m_gameEngine->getTextRenderer().flush();
+  });
+  videoManager.present();
 }
 
 void MenuScene::renderText() const {
-  SDL_Renderer *renderer      = m_gameEngine->getVideoManager().getRenderer();
+  TextRenderer &textRenderer  = m_gameEngine->getTextRenderer();
   TTF_Font     *fontLg        = m_gameEngine->getFontManager().getFontLg();
   TTF_Font     *fontMd        = m_gameEngine->getFontManager().getFontMd();
   TTF_Font     *fontSm        = m_gameEngine->getFontManager().getFontSm();
@@ -60,40 +67,44 @@ void MenuScene::renderText() const {
 
   const std::string titleText = "Yerb's Game";
   const Vec2        titlePos  = {100, 100};
-  TextHelpers::renderLineOfText(renderer, fontLg, titleText, textColor, titlePos);
+  textRenderer.renderLine(fontLg, titleText, textColor, titlePos);
 
   const std::string playText  = "Play";
   const Vec2        playPos   = titlePos + Vec2{0, 100};
   const SDL_Color   playColor = m_selectedIndex == 0 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, playText, playColor, playPos);
+  textRenderer.renderLine(fontMd, playText, playColor, playPos);
 
   const std::string instructionsText  = "How to Play";
   const Vec2        instructionsPos   = playPos + Vec2{0, 50};
   const SDL_Color   instructionsColor = m_selectedIndex == 1 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(
-      renderer, fontMd, instructionsText, instructionsColor, instructionsPos);
+  textRenderer.renderLine(fontMd, instructionsText, instructionsColor, instructionsPos);
+
+  const std::string stressText  = "Stress Test";
+  const Vec2        stressPos   = instructionsPos + Vec2{0, 50};
+  const SDL_Color   stressColor = m_selectedIndex == 2 ? selectedColor : textColor;
+  textRenderer.renderLine(fontMd, stressText, stressColor, stressPos);
 
 #ifndef __EMSCRIPTEN__
   const std::string quitText  = "Quit";
-  const Vec2        quitPos   = instructionsPos + Vec2{0, 50};
-  const SDL_Color   quitColor = m_selectedIndex == 2 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, quitText, quitColor, quitPos);
+  const Vec2        quitPos   = stressPos + Vec2{0, 50};
+  const SDL_Color   quitColor = m_selectedIndex == 3 ? selectedColor : textColor;
+  textRenderer.renderLine(fontMd, quitText, quitColor, quitPos);
 #endif
 
   const std::string controlsText = "W/S to move up/down, Enter to select";
   // bottom right corner
   const Vec2 controlsPos = {
       100, m_gameEngine->getConfigManager().getGameConfig().windowSize.y - 50};
-  TextHelpers::renderLineOfText(renderer, fontSm, controlsText, textColor, controlsPos);
+  textRenderer.renderLine(fontSm, controlsText, textColor, controlsPos);
 }
 
 void MenuScene::sDoAction(Action &action) {
 
-// Emscripten build does not have the quit option (option 3)
+// Emscripten build does not have the quit option (option 4)
 #ifdef __EMSCRIPTEN__
-  constexpr int MAX_MENU_ITEMS = 2;
-#else
   constexpr int MAX_MENU_ITEMS = 3;
+#else
+  constexpr int MAX_MENU_ITEMS = 4;
 #endif
 
   AudioSampleQueue &audioSampleQueue = m_gameEngine->getAudioSampleQueue();
@@ -111,12 +122,14 @@ void MenuScene::sDoAction(Action &action) {
   if (action.getName() == "UP") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex > 0 ? m_selectedIndex -= 1 : m_selectedIndex = MAX_MENU_ITEMS - 1;
+    m_renderCache.invalidate();
     return;
   }
 
   if (action.getName() == "DOWN") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex < MAX_MENU_ITEMS - 1 ? m_selectedIndex += 1 : m_selectedIndex = 0;
+    m_renderCache.invalidate();
   }
 }
 
@@ -132,3 +145,11 @@ void MenuScene::sAudio() {
   }
   audioSampleQueue.update();
 }
+
+void MenuScene::onSceneWindowResize() {
+  m_renderCache.invalidate();
+}
+
+void MenuScene::onRenderTargetsReset() {
+  m_renderCache.invalidate();
+}
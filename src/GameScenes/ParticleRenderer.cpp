@@ -0,0 +1,52 @@
+#include "../../includes/GameScenes/ParticleRenderer.hpp"
+
+ParticleRenderer::ParticleRenderer(SoftwareRenderer *softwareRenderer) :
+    m_batcher(softwareRenderer) {}
+
+void ParticleRenderer::build(DrawList             &drawList,
+                             JobSystem            &jobSystem,
+                             const ParticleSystem &particles) {
+  drawList.particleVertices.resize(particles.getCount() * 4);
+
+  const float *positionX = particles.getPositionX();
+  const float *positionY = particles.getPositionY();
+  const float *sizes     = particles.getSize();
+  const Color *colors    = particles.getColor();
+
+  const auto buildVertices = [&](const size_t begin, const size_t end) -> void {
+    for (size_t index = begin; index < end; index++) {
+      const float halfSize = sizes[index] / 2;
+      const float left     = positionX[index] - halfSize;
+      const float top      = positionY[index] - halfSize;
+      const float right    = positionX[index] + halfSize;
+      const float bottom   = positionY[index] + halfSize;
+
+      const Color    &color    = colors[index];
+      const float     fraction = particles.getRemainingFraction(index);
+      const SDL_Color faded    = {
+          .r = color.r,
+          .g = color.g,
+          .b = color.b,
+          .a = static_cast<Uint8>(static_cast<float>(color.a) * fraction),
+      };
+
+      SDL_Vertex *vertices = drawList.particleVertices.data() + index * 4;
+      vertices[0]          = {{left, top}, faded, {0, 0}};
+      vertices[1]          = {{right, top}, faded, {1, 0}};
+      vertices[2]          = {{right, bottom}, faded, {1, 1}};
+      vertices[3]          = {{left, bottom}, faded, {0, 1}};
+    }
+  };
+
+  constexpr size_t PARTICLE_GRAIN_SIZE = 4096;
+  jobSystem.parallelFor(0, particles.getCount(), PARTICLE_GRAIN_SIZE, buildVertices);
+}
+
+void ParticleRenderer::draw(SDL_Renderer *renderer, const DrawList &drawList) {
+  m_batcher.addQuads(drawList.particleVertices.data(), drawList.particleVertices.size() / 4);
+  m_batcher.flush(renderer);
+}
+
+size_t ParticleRenderer::getDrawCallCount() const {
+  return m_batcher.getDrawCallCount();
+}
@@ -1,11 +1,13 @@
 #include "../../../includes/GameScenes/ScoreScene/ScoreScene.hpp"
 #include "../../../includes/GameScenes/MainScene/MainScene.hpp"
 #include "../../../includes/GameScenes/MenuScene/MenuScene.hpp"
-#include "../../../includes/Helpers/TextHelpers.hpp"
 #include <SDL2/SDL.h>
 
 ScoreScene::ScoreScene(GameEngine *gameEngine, const int score) :
-    Scene(gameEngine), m_score(score) {
+    Scene(gameEngine),
+    m_score(score),
+    m_renderCache(gameEngine->getVideoManager().getRenderer(),
+                  gameEngine->getVideoManager().getSoftwareRenderer()) {
 
   registerAction(SDLK_RETURN, "SELECT");
   registerAction(SDLK_w, "UP");
@@ -30,17 +32,19 @@ void ScoreScene::onEnd() {
 }
 
 void ScoreScene::sRender() {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-  SDL_RenderClear(renderer);
-  renderText();
-  SDL_RenderPresent(renderer);
+  VideoManager &videoManager = m_gameEngine->getVideoManager();
+  m_renderCache.render([this, &videoManager]() -> void {
+    videoManager.clear({.r = 0, .g = 0, .b = 0, .a = 255});
+    renderText();
+    m_gameEngine->getTextRenderer().flush();
+  });
+  videoManager.present();
 }
 
 void ScoreScene::renderText() const {
-  SDL_Renderer *renderer = m_gameEngine->getVideoManager().getRenderer();
-  TTF_Font     *fontLg   = m_gameEngine->getFontManager().getFontLg();
-  TTF_Font     *fontMd   = m_gameEngine->getFontManager().getFontMd();
+  TextRenderer &textRenderer = m_gameEngine->getTextRenderer();
+  TTF_Font     *fontLg       = m_gameEngine->getFontManager().getFontLg();
+  TTF_Font     *fontMd       = m_gameEngine->getFontManager().getFontMd();
 
   constexpr SDL_Color gameOverColor = {255, 0, 0, 255};
   constexpr SDL_Color textColor     = {255, 255, 255, 255};
@@ -54,23 +58,23 @@ void ScoreScene::renderText() const {
 
   const std::string gameOverText = "Game Over!";
   const Vec2        gameOverPos  = {100, 300};
-  TextHelpers::renderLineOfText(renderer, fontLg, gameOverText, gameOverColor, gameOverPos);
+  textRenderer.renderLine(fontLg, gameOverText, gameOverColor, gameOverPos);
 
   const std::string scoreText = "Score: " + std::to_string(m_score);
   const Vec2        scorePos  = {100, 350};
-  TextHelpers::renderLineOfText(renderer, fontMd, scoreText, textColor, scorePos);
+  textRenderer.renderLine(fontMd, scoreText, textColor, scorePos);
 
   const float bottomOfScreen = m_gameEngine->getConfigManager().getGameConfig().windowSize.y;
 
   const std::string playAgainText  = "Play Again";
   const Vec2        playAgainPos   = {100, bottomOfScreen - 200};
   const SDL_Color   playAgainColor = m_selectedIndex == 0 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, playAgainText, playAgainColor, playAgainPos);
+  textRenderer.renderLine(fontMd, playAgainText, playAgainColor, playAgainPos);
 
   const std::string mainMenuText  = "Main Menu";
   const Vec2        mainMenuPos   = {100, bottomOfScreen - 150};
   const SDL_Color   mainMenuColor = m_selectedIndex == 1 ? selectedColor : textColor;
-  TextHelpers::renderLineOfText(renderer, fontMd, mainMenuText, mainMenuColor, mainMenuPos);
+  textRenderer.renderLine(fontMd, mainMenuText, mainMenuColor, mainMenuPos);
 }
 
 void ScoreScene::sDoAction(Action &action) {
@@ -91,12 +95,14 @@ void ScoreScene::sDoAction(Action &action) {
   if (action.getName() == "UP") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex > 0 ? m_selectedIndex -= 1 : m_selectedIndex = 1;
+    m_renderCache.invalidate();
     return;
   }
 
   if (action.getName() == "DOWN") {
     audioSampleQueue.queueSample(AudioSample::MENU_MOVE, AudioSamplePriority::BACKGROUND);
     m_selectedIndex < 1 ? m_selectedIndex += 1 : m_selectedIndex = 0;
+    m_renderCache.invalidate();
   }
 }
 
@@ -108,4 +114,12 @@ void ScoreScene::sAudio() {
   }
 
   audioSampleQueue.update();
-}
\ No newline at end of file
+}
+
+void ScoreScene::onSceneWindowResize() {
+  m_renderCache.invalidate();
+}
+
+void ScoreScene::onRenderTargetsReset() {
+  m_renderCache.invalidate();
+}
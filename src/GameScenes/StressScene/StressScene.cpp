@@ -0,0 +1,214 @@
+#include "../../../includes/GameScenes/StressScene/StressScene.hpp"
+#include "../../../includes/GameScenes/MenuScene/MenuScene.hpp"
+
+#include <array>
+#include <cstdio>
+#include <string>
+#include <utility>
+
+namespace {
+  // A fixed seed, so that every run spawns the same entities in the same places.
+  constexpr std::uint32_t STRESS_SEED = 0x5EED;
+
+  constexpr std::array<std::pair<EntityTags, const char *>, 5> TAG_LABELS = {{
+      {EntityTags::Enemy, "Enemies"},
+      {EntityTags::Bullet, "Bullets"},
+      {EntityTags::Item, "Items"},
+      {EntityTags::SpeedBoost, "Speed boosts"},
+      {EntityTags::SlownessDebuff, "Slowness debuffs"},
+  }};
+
+  std::uint32_t getFrameTimeTarget(GameEngine *gameEngine) {
+    const float frameTimeTarget =
+        gameEngine->getConfigManager().getFrameStatsConfig().frameTimeTarget;
+    return static_cast<std::uint32_t>(frameTimeTarget * 1000);
+  }
+} // namespace
+
+StressScene::StressScene(GameEngine *gameEngine) :
+    Scene(gameEngine),
+    m_simulation(gameEngine->getConfigManager(), STRESS_SEED),
+    m_scenario(gameEngine->getConfigManager().getStressConfig(),
+               getFrameTimeTarget(gameEngine)),
+    m_entityRenderer(gameEngine->getVideoManager().getSoftwareRenderer()) {
+  m_simulation.setJobSystem(&gameEngine->getJobSystem());
+
+  // Go to menu
+  registerAction(SDLK_BACKSPACE, "GO_BACK");
+}
+
+void StressScene::update() {
+  if (m_scenario.isFinished()) {
+    m_endTriggered = true;
+  } else {
+    m_sample = {};
+
+    // Every system is timed from the end of the one before it.
+    Uint64     lapStart = SDL_GetPerformanceCounter();
+    const auto lap      = [this, &lapStart](const StressSystem system) -> void {
+      const Uint64 lapEnd = SDL_GetPerformanceCounter();
+      m_sample.systemTimes[static_cast<size_t>(system)] =
+          GameEngine::toMicroseconds(lapEnd - lapStart);
+
+      lapStart = lapEnd;
+    };
+
+    m_scenario.applyTargetPopulation(m_simulation);
+    lap(StressSystem::POPULATION);
+    m_sample.entityCount = m_simulation.getEntityManager().getEntities().size();
+
+    m_simulation.beginTick(MainSceneSimulation::TICK_DURATION);
+    m_simulation.sMovement();
+    lap(StressSystem::MOVEMENT);
+    m_simulation.sCollision();
+    lap(StressSystem::COLLISION);
+    m_simulation.sLifespan();
+    lap(StressSystem::LIFESPAN);
+    m_simulation.sEffects();
+    lap(StressSystem::EFFECTS);
+
+    sAudio();
+    sRender();
+
+    // The frame time is the measured work, leaving out the overlay and the wait to present.
+    for (const std::uint32_t systemTime : m_sample.systemTimes) {
+      m_sample.frameTime += systemTime;
+    }
+    m_scenario.recordFrame(m_sample);
+    m_lastSample = m_sample;
+  }
+
+  if (m_endTriggered) {
+    onEnd();
+  }
+}
+
+void StressScene::sRender() {
+  VideoManager &videoManager = m_gameEngine->getVideoManager();
+  SDL_Renderer *renderer     = videoManager.getRenderer();
+  const Uint64  renderStart  = SDL_GetPerformanceCounter();
+  videoManager.clear({.r = 0, .g = 0, .b = 0, .a = 255});
+
+  m_entityRenderer.render(renderer,
+                          m_gameEngine->getTextureManager(),
+                          m_gameEngine->getJobSystem(),
+                          m_simulation.getEntityManager().getEntities(),
+                          m_simulation.getCurrentTime());
+  videoManager.finishFrame();
+
+  m_sample.systemTimes[static_cast<size_t>(StressSystem::RENDER)] =
+      GameEngine::toMicroseconds(SDL_GetPerformanceCounter() - renderStart);
+
+  renderOverlay();
+  m_gameEngine->getTextRenderer().flush();
+  videoManager.present();
+}
+
+void StressScene::renderOverlay() {
+  TextRenderer &textRenderer = m_gameEngine->getTextRenderer();
+  TTF_Font     *fontSm       = m_gameEngine->getFontManager().getFontSm();
+  TTF_Font     *fontMd       = m_gameEngine->getFontManager().getFontMd();
+
+  constexpr SDL_Color textColor   = {255, 255, 255, 255};
+  constexpr SDL_Color timingColor = {255, 255, 0, 255};
+  constexpr float     LINE_HEIGHT = 18;
+
+  const std::string stageText = "Stage " + std::to_string(m_scenario.getStageIndex() + 1) +
+                                " of " + std::to_string(m_scenario.getStageCount()) +
+                                (m_scenario.isRamping() ? ", ramping" : ", measuring");
+  Vec2 linePos = {10, 10};
+  textRenderer.renderLine(fontMd, stageText, textColor, linePos);
+  linePos.y += 40;
+
+  EntityManager    &entityManager = m_simulation.getEntityManager();
+  const std::string entitiesText  =
+      "Entities: " + std::to_string(entityManager.getEntities().size());
+  textRenderer.renderLine(fontSm, entitiesText, textColor, linePos);
+
+  for (const auto &[tag, label] : TAG_LABELS) {
+    const std::string tagText =
+        std::string(label) + ": " + std::to_string(entityManager.getEntities(tag).size());
+    linePos.y += LINE_HEIGHT;
+    textRenderer.renderLine(fontSm, tagText, textColor, linePos);
+  }
+
+  std::array<char, 64> line{};
+  linePos.y += LINE_HEIGHT;
+  for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+    const std::string_view name =
+        StressHelpers::getSystemName(static_cast<StressSystem>(system));
+    std::snprintf(line.data(),
+                  line.size(),
+                  "%.*s: %.2f ms",
+                  static_cast<int>(name.size()),
+                  name.data(),
+                  static_cast<double>(m_lastSample.systemTimes[system]) / 1000.0);
+
+    linePos.y += LINE_HEIGHT;
+    textRenderer.renderLine(fontSm, line.data(), timingColor, linePos);
+  }
+
+  const std::string drawCallsText =
+      "Draw calls: " + std::to_string(m_entityRenderer.getDrawCallCount());
+  linePos.y += LINE_HEIGHT;
+  textRenderer.renderLine(fontSm, drawCallsText, timingColor, linePos);
+}
+
+void StressScene::logReport() const {
+  const std::vector<StressScenario::StageResult> &results = m_scenario.getResults();
+  for (size_t stage = 0; stage < results.size(); stage++) {
+    const StressScenario::StageResult &result = results[stage];
+    if (result.frameTimes.getCount() == 0) {
+      continue;
+    }
+
+    SDL_Log("Stress stage %zu: %.0f entities, %llu frames, p50 %u us, p99 %u us, movement "
+            "%.0f us, collision %.0f us, lifespan %.0f us, render %.0f us",
+            stage + 1,
+            result.getMeanEntityCount(),
+            static_cast<unsigned long long>(result.frameTimes.getCount()),
+            result.frameTimes.getPercentile(50),
+            result.frameTimes.getPercentile(99),
+            result.getMeanSystemTime(StressSystem::MOVEMENT),
+            result.getMeanSystemTime(StressSystem::COLLISION),
+            result.getMeanSystemTime(StressSystem::LIFESPAN),
+            result.getMeanSystemTime(StressSystem::RENDER));
+  }
+}
+
+void StressScene::onEnd() {
+  logReport();
+
+  const std::optional<Path> &reportPath = m_gameEngine->getLaunchOptions().stressReportPath;
+  if (!reportPath.has_value()) {
+    m_gameEngine->loadScene("Menu", std::make_shared<MenuScene>(m_gameEngine));
+    return;
+  }
+
+  try {
+    m_scenario.saveReport(*reportPath);
+    SDL_Log("Saved stress test report to %s", reportPath->string().c_str());
+  } catch (const std::runtime_error &error) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION, "Could not save stress test report: %s", error.what());
+  }
+  m_gameEngine->quit();
+}
+
+void StressScene::sDoAction(Action &action) {
+  if (action.getState() == ActionState::START && action.getName() == "GO_BACK") {
+    m_gameEngine->getAudioSampleQueue().queueSample(AudioSample::MENU_SELECT,
+                                                    AudioSamplePriority::CRITICAL);
+    m_endTriggered = true;
+  }
+}
+
+void StressScene::sAudio() {
+  // Gameplay sounds at stress test populations would only be noise.
+  m_simulation.clearEvents();
+  m_gameEngine->getAudioSampleQueue().update();
+}
+
+void StressScene::onSceneWindowResize() {
+  m_simulation.onWindowResize();
+}
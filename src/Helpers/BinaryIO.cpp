@@ -0,0 +1,171 @@
+#include "../../includes/Helpers/BinaryIO.hpp"
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+void BinaryWriter::writeU8(const std::uint8_t value) {
+  m_buffer.push_back(value);
+}
+
+void BinaryWriter::writeU16(const std::uint16_t value) {
+  writeU8(static_cast<std::uint8_t>(value));
+  writeU8(static_cast<std::uint8_t>(value >> 8));
+}
+
+void BinaryWriter::writeU32(const std::uint32_t value) {
+  writeU16(static_cast<std::uint16_t>(value));
+  writeU16(static_cast<std::uint16_t>(value >> 16));
+}
+
+void BinaryWriter::writeU64(const std::uint64_t value) {
+  writeU32(static_cast<std::uint32_t>(value));
+  writeU32(static_cast<std::uint32_t>(value >> 32));
+}
+
+void BinaryWriter::writeFloat(const float value) {
+  writeU32(std::bit_cast<std::uint32_t>(value));
+}
+
+void BinaryWriter::writeVec2(const Vec2 &value) {
+  writeFloat(value.x);
+  writeFloat(value.y);
+}
+
+void BinaryWriter::writeVarint(std::uint64_t value) {
+  while (value >= 0x80) {
+    writeU8(static_cast<std::uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  writeU8(static_cast<std::uint8_t>(value));
+}
+
+void BinaryWriter::writeSignedVarint(const std::int64_t value) {
+  // Zigzag encoding keeps small negative values small.
+  const auto unsignedValue = static_cast<std::uint64_t>(value);
+  writeVarint((unsignedValue << 1) ^ static_cast<std::uint64_t>(value >> 63));
+}
+
+void BinaryWriter::writeString(const std::string &value) {
+  writeVarint(value.size());
+  writeBytes(value.data(), value.size());
+}
+
+void BinaryWriter::writeBytes(const void *data, const size_t size) {
+  const auto *bytes = static_cast<const std::uint8_t *>(data);
+  m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+}
+
+const std::vector<std::uint8_t> &BinaryWriter::getBuffer() const {
+  return m_buffer;
+}
+
+void BinaryWriter::clear() {
+  m_buffer.clear();
+}
+
+BinaryReader::BinaryReader(const std::uint8_t *data, const size_t size) :
+    m_data(data), m_size(size) {}
+
+BinaryReader::BinaryReader(const std::vector<std::uint8_t> &buffer) :
+    m_data(buffer.data()), m_size(buffer.size()) {}
+
+const std::uint8_t *BinaryReader::take(const size_t size) {
+  if (size > m_size - m_offset) {
+    throw BinaryFormatError("Unexpected end of binary data at offset " +
+                            std::to_string(m_offset));
+  }
+
+  const std::uint8_t *data = m_data + m_offset;
+  m_offset += size;
+  return data;
+}
+
+std::uint8_t BinaryReader::readU8() {
+  return *take(1);
+}
+
+std::uint16_t BinaryReader::readU16() {
+  const std::uint16_t low = readU8();
+  return static_cast<std::uint16_t>(low | readU8() << 8);
+}
+
+std::uint32_t BinaryReader::readU32() {
+  const std::uint32_t low = readU16();
+  return low | static_cast<std::uint32_t>(readU16()) << 16;
+}
+
+std::uint64_t BinaryReader::readU64() {
+  const std::uint64_t low = readU32();
+  return low | static_cast<std::uint64_t>(readU32()) << 32;
+}
+
+float BinaryReader::readFloat() {
+  return std::bit_cast<float>(readU32());
+}
+
+Vec2 BinaryReader::readVec2() {
+  const float x = readFloat();
+  const float y = readFloat();
+  return {x, y};
+}
+
+std::uint64_t BinaryReader::readVarint() {
+  std::uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    const std::uint8_t byte = readU8();
+    value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+  throw BinaryFormatError("Malformed varint at offset " + std::to_string(m_offset));
+}
+
+std::int64_t BinaryReader::readSignedVarint() {
+  const std::uint64_t value = readVarint();
+  return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+std::string BinaryReader::readString() {
+  const std::uint64_t size  = readVarint();
+  const auto         *bytes = reinterpret_cast<const char *>(take(size));
+  return {bytes, bytes + size};
+}
+
+void BinaryReader::readBytes(void *data, const size_t size) {
+  std::memcpy(data, take(size), size);
+}
+
+bool BinaryReader::isAtEnd() const {
+  return m_offset == m_size;
+}
+
+size_t BinaryReader::getOffset() const {
+  return m_offset;
+}
+
+namespace BinaryHelpers {
+  std::vector<std::uint8_t> readFile(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+      throw BinaryFormatError("Could not open " + path.string() + " for reading");
+    }
+
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  }
+
+  void writeFile(const std::filesystem::path &path, const std::vector<std::uint8_t> &bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      throw BinaryFormatError("Could not open " + path.string() + " for writing");
+    }
+
+    file.write(reinterpret_cast<const char *>(bytes.data()),
+               static_cast<std::streamsize>(bytes.size()));
+    if (!file) {
+      throw BinaryFormatError("Could not write " + path.string());
+    }
+  }
+} // namespace BinaryHelpers
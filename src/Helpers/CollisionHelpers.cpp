@@ -1,12 +1,13 @@
 #include "../../includes/Helpers/CollisionHelpers.hpp"
 #include "../../includes/EntityManagement/Entity.hpp"
-#include "../../includes/GameScenes/MainScene/MainScene.hpp"
 #include "../../includes/Helpers/EntityHelpers.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
 
 #include <bitset>
+#include <cmath>
 
-enum Boundaries : Uint8 { TOP, BOTTOM, LEFT, RIGHT };
-enum RelativePosition : Uint8 { ABOVE, BELOW, LEFT_OF, RIGHT_OF };
+enum Boundaries : std::uint8_t { TOP, BOTTOM, LEFT, RIGHT };
+enum RelativePosition : std::uint8_t { ABOVE, BELOW, LEFT_OF, RIGHT_OF };
 
 namespace CollisionHelpers {
   std::bitset<4> detectOutOfBounds(const std::shared_ptr<Entity> &entity,
@@ -16,10 +17,10 @@ namespace CollisionHelpers {
     const std::shared_ptr<CShape>     &cShape     = entity->getComponent<CShape>();
 
     if (!cTransform || !cShape) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a transform or shape component.",
-                   entity->id(),
-                   entity->tag());
+      LogHelpers::logError(
+          "Entity with ID %zu and tag %u lacks a transform or shape component.",
+          entity->id(),
+          entity->tag());
 
       return {};
     }
@@ -49,18 +50,16 @@ namespace CollisionHelpers {
     const auto &cShapeB = entityB->getComponent<CShape>();
 
     if (!cShapeA) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a collision component.",
-                   entityA->id(),
-                   entityA->tag());
+      LogHelpers::logError("Entity with ID %zu and tag %u lacks a collision component.",
+                           entityA->id(),
+                           entityA->tag());
       return {0, 0};
     }
 
     if (!cShapeB) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a collision component.",
-                   entityB->id(),
-                   entityB->tag());
+      LogHelpers::logError("Entity with ID %zu and tag %u lacks a collision component.",
+                           entityB->id(),
+                           entityB->tag());
       return {0, 0};
     }
 
@@ -118,10 +117,10 @@ namespace CollisionHelpers::MainScene::Enforce {
     const std::shared_ptr<CTransform> &cTransform = entity->getComponent<CTransform>();
 
     if (!cShape || !cTransform) {
-      SDL_LogError(SDL_LOG_CATEGORY_SYSTEM,
-                   "Entity with ID %zu and tag %u lacks a transform or shape component.",
-                   entity->id(),
-                   entity->tag());
+      LogHelpers::logError(
+          "Entity with ID %zu and tag %u lacks a transform or shape component.",
+          entity->id(),
+          entity->tag());
     };
 
     Vec2 &leftCornerPosition = cTransform->topLeftCornerPos;
@@ -293,39 +292,42 @@ namespace CollisionHelpers::MainScene {
     }
   }
 
-  void handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args) {
+  bool handleEntityEntityCollision(const CollisionPair &collisionPair, const GameState &args) {
     const std::shared_ptr<Entity> &entity      = collisionPair.entityA;
     const std::shared_ptr<Entity> &otherEntity = collisionPair.entityB;
 
     const EntityTags tag      = entity->tag();
     const EntityTags otherTag = otherEntity->tag();
 
-    constexpr Uint64 minSlownessDuration   = 5000;
-    constexpr Uint64 maxSlownessDuration   = 10000;
-    constexpr Uint64 minSpeedBoostDuration = 9000;
-    constexpr Uint64 maxSpeedBoostDuration = 15000;
-
-    std::uniform_int_distribution<Uint64> randomSlownessDuration(minSlownessDuration,
-                                                                 maxSlownessDuration);
-    std::uniform_int_distribution<Uint64> randomSpeedBoostDuration(minSpeedBoostDuration,
-                                                                   maxSpeedBoostDuration);
+    constexpr std::uint64_t minSlownessDuration   = 5000;
+    constexpr std::uint64_t maxSlownessDuration   = 10000;
+    constexpr std::uint64_t minSpeedBoostDuration = 9000;
+    constexpr std::uint64_t maxSpeedBoostDuration = 15000;
+
+    // Each pickup rolls its effect's duration from its own stream.
+    auto randomDuration = [&args, &otherEntity](const std::uint64_t min,
+                                                const std::uint64_t max) -> std::uint64_t {
+      RandomStream randomStream =
+          args.random.getStream(RandomStreamId::EFFECT_DURATION, otherEntity->id());
+      return static_cast<std::uint64_t>(
+          randomStream.nextInt(static_cast<int>(min), static_cast<int>(max)));
+    };
 
-    const int                      m_score           = args.score;
-    EntityManager                 &m_entities        = args.entityManager;
-    std::mt19937                  &m_randomGenerator = args.randomGenerator;
-    const std::function<void()>    decrementLives    = args.decrementLives;
-    const std::function<void(int)> setScore          = args.setScore;
-    const Vec2                    &windowSize        = args.windowSize;
+    const int                      m_score        = args.score;
+    EntityManager                 &m_entities     = args.entityManager;
+    const std::function<void()>    decrementLives = args.decrementLives;
+    const std::function<void(int)> setScore       = args.setScore;
+    const Vec2                    &windowSize     = args.windowSize;
 
     if (entity == otherEntity) {
-      return;
+      return false;
     }
 
     const bool entitiesCollided =
         CollisionHelpers::calculateCollisionBetweenEntities(entity, otherEntity);
 
     if (!entitiesCollided) {
-      return;
+      return false;
     }
 
     if (otherTag == EntityTags::Wall) {
@@ -345,14 +347,14 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Bullet && otherTag == EntityTags::Enemy) {
-      AudioSample nextSample = AudioSample::BULLET_HIT_02;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+      args.events.push_back(
+          {.type = GameEventType::BULLET_HIT_ENEMY, .position = otherEntity->getCenterPos()});
 
       const auto &cBounceTracker = entity->getComponent<CBounceTracker>();
 
       if (!cBounceTracker) {
         entity->destroy();
-        return;
+        return true;
       }
       const int bounces = cBounceTracker->getBounces();
       setScore(5 * (bounces + 1) + m_score);
@@ -361,8 +363,8 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Bullet && otherTag == EntityTags::Wall) {
-      args.audioSampleManager.queueSample(AudioSample::BULLET_HIT_01,
-                                          AudioSamplePriority::BACKGROUND);
+      args.events.push_back(
+          {.type = GameEventType::BULLET_HIT_WALL, .position = entity->getCenterPos()});
     }
 
     if (tag == EntityTags::Bullet &&
@@ -379,8 +381,8 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Player && otherTag == EntityTags::Enemy) {
-      args.audioSampleManager.queueSample(AudioSample::ENEMY_COLLISION,
-                                          AudioSamplePriority::STANDARD);
+      args.events.push_back(
+          {.type = GameEventType::PLAYER_HIT_ENEMY, .position = otherEntity->getCenterPos()});
       setScore(m_score > 10 ? m_score - 10 : 0);
       otherEntity->destroy();
       decrementLives();
@@ -401,12 +403,14 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Player && otherTag == EntityTags::SlownessDebuff) {
-      const Uint64 startTime = SDL_GetTicks64();
-      const Uint64 duration  = randomSlownessDuration(m_randomGenerator);
+      const std::uint64_t startTime = args.currentTime;
+      const std::uint64_t duration  = randomDuration(minSlownessDuration, maxSlownessDuration);
 
-      const auto &cEffects = entity->getComponent<CEffects>();
-      cEffects->addEffect(
-          {.startTime = startTime, .duration = duration, .type = EffectTypes::Slowness});
+      const auto  &cEffects = entity->getComponent<CEffects>();
+      const Effect slowness = {
+          .startTime = startTime, .duration = duration, .type = EffectTypes::Slowness};
+      cEffects->addEffect(slowness);
+      args.expiryTimers.scheduleEffect(entity, slowness);
 
       EntityVector        effectsToCheck;
       const EntityVector &slownessDebuffs = m_entities.getEntities(EntityTags::SlownessDebuff);
@@ -416,8 +420,8 @@ namespace CollisionHelpers::MainScene {
           effectsToCheck.end(), slownessDebuffs.begin(), slownessDebuffs.end());
       effectsToCheck.insert(effectsToCheck.end(), speedBoosts.begin(), speedBoosts.end());
 
-      const AudioSample nextSample = AudioSample::SLOWNESS_DEBUFF;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+      args.events.push_back(
+          {.type = GameEventType::SLOWNESS_ACQUIRED, .position = otherEntity->getCenterPos()});
 
       constexpr float    REMOVAL_RADIUS = 150.0f;
       const EntityVector entitiesToRemove =
@@ -433,15 +437,18 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Player && otherTag == EntityTags::SpeedBoost) {
-      const Uint64 startTime = SDL_GetTicks64();
-      const Uint64 duration  = randomSpeedBoostDuration(m_randomGenerator);
+      const std::uint64_t startTime = args.currentTime;
+      const std::uint64_t duration =
+          randomDuration(minSpeedBoostDuration, maxSpeedBoostDuration);
       const auto  &cEffects  = entity->getComponent<CEffects>();
 
-      cEffects->addEffect(
-          {.startTime = startTime, .duration = duration, .type = EffectTypes::Speed});
+      const Effect speedBoost = {
+          .startTime = startTime, .duration = duration, .type = EffectTypes::Speed};
+      cEffects->addEffect(speedBoost);
+      args.expiryTimers.scheduleEffect(entity, speedBoost);
 
-      const AudioSample nextSample = AudioSample::SPEED_BOOST;
-      args.audioSampleManager.queueSample(nextSample, AudioSamplePriority::STANDARD);
+      args.events.push_back({.type     = GameEventType::SPEED_BOOST_ACQUIRED,
+                             .position = otherEntity->getCenterPos()});
 
       const EntityVector &slownessDebuffs = m_entities.getEntities(EntityTags::SlownessDebuff);
       const EntityVector &speedBoosts     = m_entities.getEntities(EntityTags::SpeedBoost);
@@ -458,9 +465,11 @@ namespace CollisionHelpers::MainScene {
       for (const auto &speedBoost : speedBoosts) {
         constexpr float MULTIPLIER = 0.1f;
         const auto     &cLifespan  = speedBoost->getComponent<CLifespan>();
-        Uint64         &lifespan   = cLifespan->lifespan;
+        std::uint64_t  &lifespan   = cLifespan->lifespan;
 
-        lifespan = static_cast<Uint64>(std::round(static_cast<float>(lifespan) * MULTIPLIER));
+        lifespan =
+            static_cast<std::uint64_t>(std::round(static_cast<float>(lifespan) * MULTIPLIER));
+        args.expiryTimers.scheduleLifespan(speedBoost);
       }
       for (const auto &slowDebuff : slownessDebuffs) {
         slowDebuff->destroy();
@@ -468,8 +477,8 @@ namespace CollisionHelpers::MainScene {
     }
 
     if (tag == EntityTags::Player && otherTag == EntityTags::Item) {
-      args.audioSampleManager.queueSample(AudioSample::ITEM_ACQUIRED,
-                                          AudioSamplePriority::STANDARD);
+      args.events.push_back(
+          {.type = GameEventType::ITEM_ACQUIRED, .position = otherEntity->getCenterPos()});
       setScore(m_score + 90);
       otherEntity->destroy();
     }
@@ -485,6 +494,8 @@ namespace CollisionHelpers::MainScene {
     if (tag == EntityTags::Item && otherTag == EntityTags::SlownessDebuff) {
       Enforce::enforceEntityEntityCollision(entity, otherEntity);
     }
+
+    return true;
   }
 
 } // namespace CollisionHelpers::MainScene
\ No newline at end of file
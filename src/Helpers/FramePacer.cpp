@@ -0,0 +1,76 @@
+#include "../../includes/Helpers/FramePacer.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+  constexpr std::uint32_t PACING_HITCH_THRESHOLD = 1000;
+
+  // Each sleep moves the overshoot estimate an eighth of the way to its own overshoot.
+  constexpr int OVERSHOOT_SMOOTHING = 8;
+} // namespace
+
+FramePacer::FramePacer(const FramePacingMode mode,
+                       const float           frameRate,
+                       const float           spinThreshold) :
+    m_mode(mode),
+    m_frameRate(frameRate),
+    m_frameDuration(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / static_cast<double>(frameRate)))),
+    m_spinThreshold(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(spinThreshold))),
+    m_pacingErrors(PACING_HITCH_THRESHOLD) {}
+
+void FramePacer::sleepUntil(const Clock::time_point deadline) {
+  const Clock::time_point sleepStart = Clock::now();
+  const Clock::duration   spinMargin = m_spinThreshold + m_sleepOvershoot;
+  if (deadline - sleepStart > spinMargin) {
+    const Clock::duration requested = deadline - sleepStart - spinMargin;
+    std::this_thread::sleep_for(requested);
+
+    const Clock::duration overshoot =
+        std::max(Clock::now() - sleepStart - requested, Clock::duration::zero());
+    m_sleepOvershoot = m_sleepOvershoot + (overshoot - m_sleepOvershoot) / OVERSHOOT_SMOOTHING;
+  }
+
+  while (Clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+}
+
+void FramePacer::waitForNextFrame() {
+  if (m_mode == FramePacingMode::UNCAPPED) {
+    return;
+  }
+
+  if (m_mode == FramePacingMode::CAP) {
+    m_nextFrame = std::max(m_nextFrame + m_frameDuration, Clock::now());
+    sleepUntil(m_nextFrame);
+  }
+
+  const Clock::time_point frameEnd = Clock::now();
+  if (m_lastFrameEnd != Clock::time_point{}) {
+    const auto error = std::chrono::duration_cast<std::chrono::microseconds>(
+        frameEnd - m_lastFrameEnd - m_frameDuration);
+    m_pacingErrors.record(static_cast<std::uint32_t>(std::abs(error.count())));
+  }
+  m_lastFrameEnd = frameEnd;
+}
+
+void FramePacer::reset() {
+  m_nextFrame    = {};
+  m_lastFrameEnd = {};
+}
+
+FramePacingMode FramePacer::getMode() const {
+  return m_mode;
+}
+
+float FramePacer::getFrameRate() const {
+  return m_frameRate;
+}
+
+const FrameTimeHistogram &FramePacer::getPacingErrors() const {
+  return m_pacingErrors;
+}
@@ -0,0 +1,88 @@
+#include "../../includes/Helpers/FrameTimeHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+  constexpr std::uint32_t SUB_BUCKET_COUNT = FrameTimeHistogram::EXACT_LIMIT / 2;
+  constexpr int           SUB_BUCKET_BITS  = std::countr_zero(SUB_BUCKET_COUNT);
+} // namespace
+
+FrameTimeHistogram::FrameTimeHistogram(const std::uint32_t hitchThreshold) :
+    m_hitchThreshold(hitchThreshold) {}
+
+size_t FrameTimeHistogram::getBucketIndex(const std::uint32_t frameTime) {
+  if (frameTime < EXACT_LIMIT) {
+    return frameTime;
+  }
+
+  // The top bits below the leading one pick the sub-bucket within the value's power of two.
+  const int           magnitude = std::bit_width(frameTime) - 1;
+  const int           shift     = magnitude - SUB_BUCKET_BITS;
+  const std::uint32_t subBucket = (frameTime >> shift) - SUB_BUCKET_COUNT;
+
+  return EXACT_LIMIT + static_cast<size_t>(shift - 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+std::uint32_t FrameTimeHistogram::getBucketUpperBound(const size_t bucketIndex) {
+  if (bucketIndex < EXACT_LIMIT) {
+    return static_cast<std::uint32_t>(bucketIndex);
+  }
+
+  const size_t        offset    = bucketIndex - EXACT_LIMIT;
+  const int           shift     = static_cast<int>(offset / SUB_BUCKET_COUNT) + 1;
+  const std::uint64_t subBucket = SUB_BUCKET_COUNT + offset % SUB_BUCKET_COUNT;
+
+  return static_cast<std::uint32_t>(((subBucket + 1) << shift) - 1);
+}
+
+void FrameTimeHistogram::record(const std::uint32_t frameTime) {
+  m_counts[getBucketIndex(frameTime)] += 1;
+  m_count += 1;
+  m_totalTime += frameTime;
+  m_maxTime = std::max(m_maxTime, frameTime);
+
+  if (frameTime > m_hitchThreshold) {
+    m_hitchCount += 1;
+  }
+}
+
+std::uint32_t FrameTimeHistogram::getPercentile(const double percentile) const {
+  if (m_count == 0) {
+    return 0;
+  }
+
+  // The rank of the frame at the percentile, counting from one.
+  const double        clamped = std::clamp(percentile, 0.0, 100.0);
+  const double        rank    = std::ceil(clamped / 100.0 * static_cast<double>(m_count));
+  const std::uint64_t target  = std::max<std::uint64_t>(static_cast<std::uint64_t>(rank), 1);
+
+  std::uint64_t seen = 0;
+  for (size_t bucketIndex = 0; bucketIndex < BUCKET_COUNT; bucketIndex++) {
+    seen += m_counts[bucketIndex];
+    if (seen >= target) {
+      return std::min(getBucketUpperBound(bucketIndex), m_maxTime);
+    }
+  }
+  return m_maxTime;
+}
+
+std::uint64_t FrameTimeHistogram::getCount() const {
+  return m_count;
+}
+
+std::uint32_t FrameTimeHistogram::getMax() const {
+  return m_maxTime;
+}
+
+float FrameTimeHistogram::getMean() const {
+  return m_count == 0 ? 0 : static_cast<float>(m_totalTime) / static_cast<float>(m_count);
+}
+
+std::uint64_t FrameTimeHistogram::getHitchCount() const {
+  return m_hitchCount;
+}
+
+std::uint32_t FrameTimeHistogram::getHitchThreshold() const {
+  return m_hitchThreshold;
+}
@@ -0,0 +1,87 @@
+#include "../../includes/Helpers/FrameTimeLog.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+  std::string formatTransitionTime(const std::optional<std::uint32_t> &transitionTime) {
+    return transitionTime.has_value() ? std::to_string(*transitionTime) : "";
+  }
+} // namespace
+
+FrameTimeLog::FrameTimeLog(const std::uint32_t frameTimeTarget) :
+    m_hitchThreshold(frameTimeTarget * FrameTimeHistogram::HITCH_TARGET_MULTIPLE) {}
+
+void FrameTimeLog::beginScene(const std::string &sceneName) {
+  m_scenes.push_back({
+      .sceneName      = sceneName,
+      .histogram      = FrameTimeHistogram(m_hitchThreshold),
+      .transitionTime = std::nullopt,
+  });
+}
+
+void FrameTimeLog::record(const std::uint32_t frameTime) {
+  if (m_scenes.empty()) {
+    return;
+  }
+
+  SceneFrameTimes &scene = m_scenes.back();
+  if (!scene.transitionTime.has_value()) {
+    scene.transitionTime = frameTime;
+    return;
+  }
+
+  scene.histogram.record(frameTime);
+}
+
+const std::vector<FrameTimeLog::SceneFrameTimes> &FrameTimeLog::getScenes() const {
+  return m_scenes;
+}
+
+void FrameTimeLog::save(const std::filesystem::path &path) const {
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("Could not open " + path.string() + " for writing");
+  }
+
+  if (path.extension() == ".csv") {
+    file << "scene,frames,mean_us,p50_us,p90_us,p99_us,p99.9_us,max_us,hitches,"
+            "transition_us\n";
+    for (const SceneFrameTimes &scene : m_scenes) {
+      const FrameTimeHistogram &histogram = scene.histogram;
+      file << scene.sceneName << ',' << histogram.getCount() << ',' << histogram.getMean()
+           << ',' << histogram.getPercentile(50) << ',' << histogram.getPercentile(90) << ','
+           << histogram.getPercentile(99) << ',' << histogram.getPercentile(99.9) << ','
+           << histogram.getMax() << ',' << histogram.getHitchCount() << ','
+           << formatTransitionTime(scene.transitionTime) << '\n';
+    }
+  } else {
+    nlohmann::json scenes = nlohmann::json::array();
+    for (const SceneFrameTimes &scene : m_scenes) {
+      const FrameTimeHistogram &histogram = scene.histogram;
+      scenes.push_back({
+          {"scene", scene.sceneName},
+          {"frames", histogram.getCount()},
+          {"meanUs", histogram.getMean()},
+          {"p50Us", histogram.getPercentile(50)},
+          {"p90Us", histogram.getPercentile(90)},
+          {"p99Us", histogram.getPercentile(99)},
+          {"p99_9Us", histogram.getPercentile(99.9)},
+          {"maxUs", histogram.getMax()},
+          {"hitches", histogram.getHitchCount()},
+          {"transitionUs", scene.transitionTime.has_value()
+                               ? nlohmann::json(*scene.transitionTime)
+                               : nlohmann::json(nullptr)},
+      });
+    }
+
+    file << nlohmann::json{{"hitchThresholdUs", m_hitchThreshold}, {"scenes", scenes}}.dump(2)
+         << '\n';
+  }
+
+  if (!file) {
+    throw std::runtime_error("Could not write " + path.string());
+  }
+}
@@ -0,0 +1,45 @@
+#include "../../includes/Helpers/LogHelpers.hpp"
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+
+namespace LogHelpers {
+  namespace {
+    LogSink &getLogSink() {
+      static LogSink sink;
+      return sink;
+    }
+
+    void log(const LogLevel level, const char *format, va_list args) {
+      constexpr size_t MAX_MESSAGE_LENGTH = 1024;
+      char             message[MAX_MESSAGE_LENGTH];
+      std::vsnprintf(message, MAX_MESSAGE_LENGTH, format, args);
+
+      const LogSink &sink = getLogSink();
+      if (sink) {
+        sink(level, message);
+        return;
+      }
+
+      std::cerr << (level == LogLevel::ERROR ? "ERROR: " : "INFO: ") << message << '\n';
+    }
+  } // namespace
+
+  void setLogSink(LogSink sink) {
+    getLogSink() = std::move(sink);
+  }
+
+  void logInfo(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    log(LogLevel::INFO, format, args);
+    va_end(args);
+  }
+
+  void logError(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    log(LogLevel::ERROR, format, args);
+    va_end(args);
+  }
+} // namespace LogHelpers
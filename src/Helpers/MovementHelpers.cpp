@@ -1,4 +1,6 @@
 #include "../../includes/Helpers/MovementHelpers.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
+#include <cmath>
 
 constexpr float BASE_MOVEMENT_MULTIPLIER = 50.0f;
 
@@ -9,7 +11,7 @@ namespace MovementHelpers {
                    const float                   &deltaTime) {
 
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -20,9 +22,7 @@ namespace MovementHelpers {
 
     const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
       return;
     }
 
@@ -36,7 +36,7 @@ namespace MovementHelpers {
                        const SpeedEffectConfig       &speedBoostEffectConfig,
                        const float                   &deltaTime) {
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -47,9 +47,7 @@ namespace MovementHelpers {
 
     const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
       return;
     }
 
@@ -63,7 +61,7 @@ namespace MovementHelpers {
                   const PlayerConfig            &playerConfig,
                   const float                   &deltaTime) {
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -74,17 +72,13 @@ namespace MovementHelpers {
 
     const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
       return;
     }
 
     const std::shared_ptr<CInput> &entityCInput = entity->getComponent<CInput>();
     if (entityCInput == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks an input component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks an input component.", entity->id());
       return;
     }
 
@@ -129,7 +123,7 @@ namespace MovementHelpers {
                            const float                   &deltaTime) {
 
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -142,17 +136,13 @@ namespace MovementHelpers {
     const std::shared_ptr<CShape>     &entityCShape     = entity->getComponent<CShape>();
 
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
 
       return;
     }
 
     if (entityCShape == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a shape component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a shape component.", entity->id());
 
       return;
     }
@@ -165,7 +155,7 @@ namespace MovementHelpers {
 
   void moveBullets(const std::shared_ptr<Entity> &entity, const float &deltaTime) {
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -176,9 +166,7 @@ namespace MovementHelpers {
 
     const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
       return;
     }
 
@@ -188,9 +176,11 @@ namespace MovementHelpers {
     constexpr float BULLET_MOVEMENT_MULTIPLIER = 3.0f;
     position += velocity * (deltaTime * BULLET_MOVEMENT_MULTIPLIER * BASE_MOVEMENT_MULTIPLIER);
   }
-  void moveItems(const std::shared_ptr<Entity> &entity, const float &deltaTime) {
+  void moveItems(const std::shared_ptr<Entity> &entity,
+                 const float                   &deltaTime,
+                 const std::uint64_t            currentTime) {
     if (entity == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Entity is null");
+      LogHelpers::logError("Entity is null");
       return;
     }
 
@@ -203,9 +193,7 @@ namespace MovementHelpers {
     const std::shared_ptr<CTransform> &entityCTransform = entity->getComponent<CTransform>();
 
     if (entityCTransform == nullptr) {
-      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
-                   "Entity with ID %zu lacks a transform component.",
-                   entity->id());
+      LogHelpers::logError("Entity with ID %zu lacks a transform component.", entity->id());
       return;
     }
 
@@ -213,7 +201,7 @@ namespace MovementHelpers {
 
     // Use deltaTime to maintain consistent movement speed
     constexpr float ITEM_MOVEMENT_MULTIPLIER = .9f;
-    const float     time                     = static_cast<float>(SDL_GetTicks64()) / 1000.0f;
+    const float     time                     = static_cast<float>(currentTime) / 1000.0f;
     // Entity id will be odd when the last bit is 1
     const bool ENTITY_ID_ODD = entity->id() & 1;
 
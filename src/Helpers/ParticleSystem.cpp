@@ -0,0 +1,150 @@
+#include "../../includes/Helpers/ParticleSystem.hpp"
+#include "../../includes/Helpers/RandomStream.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+  // Particles have their own random streams, so emitting them leaves the simulation's alone.
+  constexpr std::uint64_t PARTICLE_STREAM_KEY = 0x50415254;
+
+  // The fraction of its speed a particle still has after a second.
+  constexpr float SPEED_KEPT_PER_SECOND = 0.05f;
+
+  // Keeps a burst with no lifetime from dividing by zero.
+  constexpr float MIN_LIFETIME = 0.001f;
+
+  float interpolate(const float min, const float max, const float fraction) {
+    return min + (max - min) * fraction;
+  }
+} // namespace
+
+ParticleSystem::ParticleSystem(const size_t capacity) :
+    m_capacity(capacity),
+    m_positionX(capacity),
+    m_positionY(capacity),
+    m_velocityX(capacity),
+    m_velocityY(capacity),
+    m_remainingLifetime(capacity),
+    m_inverseLifetime(capacity),
+    m_size(capacity),
+    m_color(capacity) {}
+
+void ParticleSystem::emit(const Burst &burst) {
+  RandomStream random(PARTICLE_STREAM_KEY, m_burstCount, 0);
+  m_burstCount += 1;
+
+  const size_t count = std::min<size_t>(burst.count, m_capacity - m_count);
+  for (size_t emitted = 0; emitted < count; emitted++) {
+    const float angle = random.nextFloat() * 2 * std::numbers::pi_v<float>;
+    const float speed = interpolate(burst.minSpeed, burst.maxSpeed, random.nextFloat());
+    const float lifetime =
+        std::max(interpolate(burst.minLifetime, burst.maxLifetime, random.nextFloat()),
+                 MIN_LIFETIME);
+
+    const size_t index         = m_count;
+    m_positionX[index]         = burst.position.x;
+    m_positionY[index]         = burst.position.y;
+    m_velocityX[index]         = std::cos(angle) * speed;
+    m_velocityY[index]         = std::sin(angle) * speed;
+    m_remainingLifetime[index] = lifetime;
+    m_inverseLifetime[index]   = 1 / lifetime;
+    m_size[index]              = burst.size;
+    m_color[index]             = burst.color;
+    m_count += 1;
+  }
+}
+
+void ParticleSystem::update(const float deltaTime) {
+  const float drag = std::pow(SPEED_KEPT_PER_SECOND, deltaTime);
+
+  // Both paths slow each particle down before moving it by its new velocity.
+  size_t index = 0;
+#if defined(__SSE2__)
+  const __m128 stepLanes = _mm_set1_ps(deltaTime);
+  const __m128 dragLanes = _mm_set1_ps(drag);
+  for (; index + 4 <= m_count; index += 4) {
+    const __m128 velocityX = _mm_mul_ps(_mm_loadu_ps(&m_velocityX[index]), dragLanes);
+    const __m128 velocityY = _mm_mul_ps(_mm_loadu_ps(&m_velocityY[index]), dragLanes);
+    const __m128 positionX = _mm_loadu_ps(&m_positionX[index]);
+    const __m128 positionY = _mm_loadu_ps(&m_positionY[index]);
+    const __m128 remaining = _mm_loadu_ps(&m_remainingLifetime[index]);
+
+    _mm_storeu_ps(&m_velocityX[index], velocityX);
+    _mm_storeu_ps(&m_velocityY[index], velocityY);
+    _mm_storeu_ps(&m_positionX[index],
+                  _mm_add_ps(positionX, _mm_mul_ps(velocityX, stepLanes)));
+    _mm_storeu_ps(&m_positionY[index],
+                  _mm_add_ps(positionY, _mm_mul_ps(velocityY, stepLanes)));
+    _mm_storeu_ps(&m_remainingLifetime[index], _mm_sub_ps(remaining, stepLanes));
+  }
+#endif
+  for (; index < m_count; index++) {
+    m_velocityX[index]         = m_velocityX[index] * drag;
+    m_velocityY[index]         = m_velocityY[index] * drag;
+    m_positionX[index]         = m_positionX[index] + m_velocityX[index] * deltaTime;
+    m_positionY[index]         = m_positionY[index] + m_velocityY[index] * deltaTime;
+    m_remainingLifetime[index] = m_remainingLifetime[index] - deltaTime;
+  }
+
+  removeDead();
+}
+
+void ParticleSystem::removeDead() {
+  size_t index = 0;
+  while (index < m_count) {
+    if (m_remainingLifetime[index] > 0) {
+      index++;
+      continue;
+    }
+
+    // The last live particle takes the dead one's place, and is checked next.
+    const size_t last          = m_count - 1;
+    m_positionX[index]         = m_positionX[last];
+    m_positionY[index]         = m_positionY[last];
+    m_velocityX[index]         = m_velocityX[last];
+    m_velocityY[index]         = m_velocityY[last];
+    m_remainingLifetime[index] = m_remainingLifetime[last];
+    m_inverseLifetime[index]   = m_inverseLifetime[last];
+    m_size[index]              = m_size[last];
+    m_color[index]             = m_color[last];
+    m_count                    = last;
+  }
+}
+
+void ParticleSystem::clear() {
+  m_count = 0;
+}
+
+size_t ParticleSystem::getCount() const {
+  return m_count;
+}
+
+size_t ParticleSystem::getCapacity() const {
+  return m_capacity;
+}
+
+const float *ParticleSystem::getPositionX() const {
+  return m_positionX.data();
+}
+
+const float *ParticleSystem::getPositionY() const {
+  return m_positionY.data();
+}
+
+const float *ParticleSystem::getSize() const {
+  return m_size.data();
+}
+
+const Color *ParticleSystem::getColor() const {
+  return m_color.data();
+}
+
+float ParticleSystem::getRemainingFraction(const size_t index) const {
+  return std::clamp(m_remainingLifetime[index] * m_inverseLifetime[index], 0.0f, 1.0f);
+}
@@ -0,0 +1,215 @@
+#include "../../includes/Helpers/Profiler.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace Profiler {
+  namespace {
+    // Zones kept per thread; at a few dozen zones per frame, several seconds of history.
+    constexpr std::uint64_t ZONE_BUFFER_CAPACITY = 1 << 14;
+
+    struct ZoneSlot {
+      std::atomic<const char *>  name{nullptr};
+      std::atomic<std::uint64_t> start{0};
+      std::atomic<std::uint64_t> end{0};
+    };
+
+    /**
+     * A single-writer ring buffer. The writer claims a position before overwriting its slot
+     * and publishes it afterwards, so readers can tell which of the slots they copied may
+     * have been overwritten meanwhile.
+     */
+    struct ZoneBuffer {
+      std::array<ZoneSlot, ZONE_BUFFER_CAPACITY> slots;
+      std::atomic<std::uint64_t>                 claimed{0};
+      std::atomic<std::uint64_t>                 published{0};
+    };
+
+    struct ZoneBufferRegistry {
+      std::mutex                               mutex;
+      std::vector<std::unique_ptr<ZoneBuffer>> buffers;
+    };
+
+    ZoneBufferRegistry &getRegistry() {
+      static ZoneBufferRegistry registry;
+      return registry;
+    }
+
+    // Buffers are registered on a thread's first zone and outlive the thread, so its zones
+    // can still be exported.
+    ZoneBuffer &getThreadBuffer() {
+      thread_local ZoneBuffer *buffer = nullptr;
+      if (buffer == nullptr) {
+        ZoneBufferRegistry &registry = getRegistry();
+        std::lock_guard     lock(registry.mutex);
+        buffer = registry.buffers.emplace_back(std::make_unique<ZoneBuffer>()).get();
+      }
+      return *buffer;
+    }
+
+    std::chrono::steady_clock::time_point getEpoch() {
+      static const auto epoch = std::chrono::steady_clock::now();
+      return epoch;
+    }
+  } // namespace
+
+  std::uint64_t now() {
+    const auto elapsed = std::chrono::steady_clock::now() - getEpoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  }
+
+  void recordZone(const char *name, const std::uint64_t start, const std::uint64_t end) {
+    ZoneBuffer         &buffer   = getThreadBuffer();
+    const std::uint64_t position = buffer.published.load(std::memory_order_relaxed);
+    ZoneSlot           &slot     = buffer.slots[position % ZONE_BUFFER_CAPACITY];
+
+    buffer.claimed.store(position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+
+    buffer.published.store(position + 1, std::memory_order_release);
+  }
+
+  ScopedZone::ScopedZone(const char *name) :
+      m_name(name),
+      m_start(now()) {}
+
+  ScopedZone::~ScopedZone() {
+    recordZone(m_name, m_start, now());
+  }
+
+  void ZoneCursor::read(std::vector<Zone> &zones) {
+    ZoneBufferRegistry &registry = getRegistry();
+    std::lock_guard     lock(registry.mutex);
+    m_positions.resize(registry.buffers.size(), 0);
+
+    for (size_t threadIndex = 0; threadIndex < registry.buffers.size(); threadIndex++) {
+      const ZoneBuffer   &buffer    = *registry.buffers[threadIndex];
+      const std::uint64_t published = buffer.published.load(std::memory_order_acquire);
+      const std::uint64_t oldest =
+          published > ZONE_BUFFER_CAPACITY ? published - ZONE_BUFFER_CAPACITY : 0;
+      const std::uint64_t first      = std::max(m_positions[threadIndex], oldest);
+      const size_t        firstIndex = zones.size();
+
+      for (std::uint64_t position = first; position < published; position++) {
+        const ZoneSlot &slot = buffer.slots[position % ZONE_BUFFER_CAPACITY];
+        zones.push_back({
+            .name        = slot.name.load(std::memory_order_relaxed),
+            .start       = slot.start.load(std::memory_order_relaxed),
+            .end         = slot.end.load(std::memory_order_relaxed),
+            .threadIndex = static_cast<std::uint32_t>(threadIndex),
+        });
+      }
+
+      // Positions the writer has claimed since reuse the slots of the oldest copied zones.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const std::uint64_t claimed = buffer.claimed.load(std::memory_order_relaxed);
+      if (claimed > first + ZONE_BUFFER_CAPACITY) {
+        const std::uint64_t overwritten =
+            std::min(claimed - ZONE_BUFFER_CAPACITY - first, published - first);
+        zones.erase(zones.begin() + static_cast<std::ptrdiff_t>(firstIndex),
+                    zones.begin() + static_cast<std::ptrdiff_t>(firstIndex + overwritten));
+      }
+
+      m_positions[threadIndex] = published;
+    }
+  }
+
+  void ZoneCursor::skip() {
+    ZoneBufferRegistry &registry = getRegistry();
+    std::lock_guard     lock(registry.mutex);
+    m_positions.resize(registry.buffers.size(), 0);
+
+    for (size_t threadIndex = 0; threadIndex < registry.buffers.size(); threadIndex++) {
+      m_positions[threadIndex] =
+          registry.buffers[threadIndex]->published.load(std::memory_order_acquire);
+    }
+  }
+
+  size_t exportChromeTrace(const std::filesystem::path &path) {
+    std::vector<Zone> zones;
+    ZoneCursor().read(zones);
+
+    // Complete events, with timestamps and durations in microseconds.
+    nlohmann::json traceEvents = nlohmann::json::array();
+    for (const Zone &zone : zones) {
+      traceEvents.push_back({
+          {"name", zone.name},
+          {"ph", "X"},
+          {"ts", static_cast<double>(zone.start) / 1000.0},
+          {"dur", static_cast<double>(zone.end - zone.start) / 1000.0},
+          {"pid", 0},
+          {"tid", zone.threadIndex},
+      });
+    }
+
+    std::ofstream file(path);
+    if (!file) {
+      throw std::runtime_error("Could not open " + path.string() + " for writing");
+    }
+
+    file << nlohmann::json{{"traceEvents", traceEvents}, {"displayTimeUnit", "ms"}};
+    if (!file) {
+      throw std::runtime_error("Could not write " + path.string());
+    }
+    return zones.size();
+  }
+
+  ZoneStatistics::ZoneStatistics() {
+    m_cursor.skip();
+  }
+
+  void ZoneStatistics::update() {
+    m_zones.clear();
+    m_cursor.read(m_zones);
+
+    // The slot of the frame that drops out of the window is reused for this one.
+    const size_t frameSlot = m_frameCount % WINDOW_FRAMES;
+    for (auto &[name, history] : m_histories) {
+      history.totalTime -= history.frameTimes[frameSlot];
+      history.frameTimes[frameSlot] = 0;
+    }
+
+    for (const Zone &zone : m_zones) {
+      History &history = m_histories[zone.name];
+      history.frameTimes[frameSlot] += zone.end - zone.start;
+      history.totalTime += zone.end - zone.start;
+    }
+
+    m_frameCount += 1;
+  }
+
+  std::vector<ZoneStatistics::Summary> ZoneStatistics::getSummaries() const {
+    constexpr float NANOSECONDS_PER_MILLISECOND = 1000000.0f;
+
+    const size_t frames = std::clamp<size_t>(m_frameCount, 1, WINDOW_FRAMES);
+
+    std::vector<Summary> summaries;
+    for (const auto &[name, history] : m_histories) {
+      const std::uint64_t maxTime =
+          *std::max_element(history.frameTimes.begin(), history.frameTimes.end());
+
+      summaries.push_back({
+          .name        = name,
+          .averageTime = static_cast<float>(history.totalTime) / static_cast<float>(frames) /
+                         NANOSECONDS_PER_MILLISECOND,
+          .maxTime     = static_cast<float>(maxTime) / NANOSECONDS_PER_MILLISECOND,
+      });
+    }
+
+    std::ranges::sort(summaries, [](const Summary &a, const Summary &b) {
+      return a.averageTime > b.averageTime;
+    });
+    return summaries;
+  }
+} // namespace Profiler
@@ -0,0 +1,62 @@
+#include "../../includes/Helpers/RandomStream.hpp"
+
+namespace {
+  constexpr std::uint32_t PHILOX_MULTIPLIER_0 = 0xD2511F53;
+  constexpr std::uint32_t PHILOX_MULTIPLIER_1 = 0xCD9E8D57;
+  constexpr std::uint32_t PHILOX_WEYL_0       = 0x9E3779B9;
+  constexpr std::uint32_t PHILOX_WEYL_1       = 0xBB67AE85;
+  constexpr int           PHILOX_ROUNDS       = 10;
+
+  std::array<std::uint32_t, 4> philox(std::array<std::uint32_t, 4> counter,
+                                      std::array<std::uint32_t, 2> key) {
+    for (int round = 0; round < PHILOX_ROUNDS; round++) {
+      const std::uint64_t product0 = std::uint64_t{PHILOX_MULTIPLIER_0} * counter[0];
+      const std::uint64_t product1 = std::uint64_t{PHILOX_MULTIPLIER_1} * counter[2];
+
+      counter = {
+          static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+          static_cast<std::uint32_t>(product1),
+          static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+          static_cast<std::uint32_t>(product0),
+      };
+
+      key[0] += PHILOX_WEYL_0;
+      key[1] += PHILOX_WEYL_1;
+    }
+    return counter;
+  }
+} // namespace
+
+RandomStream::RandomStream(const std::uint64_t key,
+                           const std::uint64_t tick,
+                           const std::uint32_t subject) :
+    m_counter({0,
+               subject,
+               static_cast<std::uint32_t>(tick),
+               static_cast<std::uint32_t>(tick >> 32)}),
+    m_key({static_cast<std::uint32_t>(key), static_cast<std::uint32_t>(key >> 32)}),
+    m_nextOutput(m_block.size()) {}
+
+std::uint32_t RandomStream::nextU32() {
+  // The first counter word numbers the blocks within the stream.
+  if (m_nextOutput == m_block.size()) {
+    m_block = philox(m_counter, m_key);
+    m_counter[0] += 1;
+    m_nextOutput = 0;
+  }
+  return m_block[m_nextOutput++];
+}
+
+std::uint32_t RandomStream::nextBelow(const std::uint32_t bound) {
+  return static_cast<std::uint32_t>((static_cast<std::uint64_t>(nextU32()) * bound) >> 32);
+}
+
+int RandomStream::nextInt(const int min, const int max) {
+  const auto range = static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - min + 1);
+  return static_cast<int>(static_cast<std::int64_t>(min) + nextBelow(range));
+}
+
+float RandomStream::nextFloat() {
+  // The top 24 bits fill a float's significand exactly.
+  return static_cast<float>(nextU32() >> 8) * 0x1.0p-24f;
+}
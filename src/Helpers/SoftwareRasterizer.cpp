@@ -0,0 +1,351 @@
+#include "../../includes/Helpers/SoftwareRasterizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+  // Tall enough that a tile's quads are worth a job, short enough to spread a frame across
+  // every thread.
+  constexpr int TILE_HEIGHT = 32;
+
+  constexpr std::uint32_t OPAQUE_WHITE = 0xFFFFFFFF;
+
+  // Texture coordinates are stepped across a span in 16.16 fixed point.
+  constexpr int    FIXED_SHIFT = 16;
+  constexpr double FIXED_ONE   = 1 << FIXED_SHIFT;
+
+  /**
+   * Rounds `value / 255` to the nearest integer, for values up to 255 * 255.
+   */
+  std::uint32_t divide255(std::uint32_t value) {
+    value = value + 128;
+    return (value + (value >> 8)) >> 8;
+  }
+
+  std::uint32_t modulatePixel(const std::uint32_t texel, const std::uint32_t color) {
+    std::uint32_t result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+      const std::uint32_t product = ((texel >> shift) & 0xFF) * ((color >> shift) & 0xFF);
+      result |= divide255(product) << shift;
+    }
+    return result;
+  }
+
+  /**
+   * `src * srcA + dst * (1 - srcA)` for the colour, and `srcA + dstA * (1 - srcA)` for the
+   * alpha, as SDL blends.
+   */
+  std::uint32_t blendPixel(const std::uint32_t src, const std::uint32_t dst) {
+    const std::uint32_t alpha  = src >> 24;
+    const std::uint32_t opaque = src | 0xFF000000;
+    std::uint32_t       result = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+      const std::uint32_t blended =
+          ((opaque >> shift) & 0xFF) * alpha + ((dst >> shift) & 0xFF) * (255 - alpha);
+      result |= divide255(blended) << shift;
+    }
+    return result;
+  }
+
+#if defined(__SSE2__)
+  /**
+   * `divide255` on eight 16-bit lanes.
+   */
+  __m128i divide255(__m128i value) {
+    value = _mm_add_epi16(value, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+  }
+
+  /**
+   * `modulatePixel` on two pixels unpacked to 16-bit lanes.
+   */
+  __m128i modulateUnpacked(const __m128i texels, const __m128i color) {
+    return divide255(_mm_mullo_epi16(texels, color));
+  }
+
+  /**
+   * `blendPixel` on two pixels unpacked to 16-bit lanes. Each pixel's alpha is its fourth
+   * lane, which the products and their sum fit in unsigned.
+   */
+  __m128i blendUnpacked(const __m128i src, const __m128i dst) {
+    const __m128i alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+    const __m128i alpha      = _mm_shufflehi_epi16(
+        _mm_shufflelo_epi16(src, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+    const __m128i opaque  = _mm_or_si128(src, alphaLanes);
+    return divide255(
+        _mm_add_epi16(_mm_mullo_epi16(opaque, alpha), _mm_mullo_epi16(dst, inverse)));
+  }
+
+  __m128i modulate4(const __m128i texels, const __m128i color) {
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_packus_epi16(modulateUnpacked(_mm_unpacklo_epi8(texels, zero), color),
+                            modulateUnpacked(_mm_unpackhi_epi8(texels, zero), color));
+  }
+
+  void blend4(const __m128i src, std::uint32_t *pixels) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dst  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels));
+    const __m128i low =
+        blendUnpacked(_mm_unpacklo_epi8(src, zero), _mm_unpacklo_epi8(dst, zero));
+    const __m128i high =
+        blendUnpacked(_mm_unpackhi_epi8(src, zero), _mm_unpackhi_epi8(dst, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels), _mm_packus_epi16(low, high));
+  }
+#endif
+
+  void fillSpan(std::uint32_t *pixels, const int count, const std::uint32_t color) {
+    int index = 0;
+#if defined(__SSE2__)
+    const __m128i colors = _mm_set1_epi32(static_cast<int>(color));
+    for (; index + 4 <= count; index += 4) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + index), colors);
+    }
+#endif
+    for (; index < count; index++) {
+      pixels[index] = color;
+    }
+  }
+
+  void blendSpan(std::uint32_t *pixels, const int count, const std::uint32_t color) {
+    int index = 0;
+#if defined(__SSE2__)
+    const __m128i colors = _mm_set1_epi32(static_cast<int>(color));
+    for (; index + 4 <= count; index += 4) {
+      blend4(colors, pixels + index);
+    }
+#endif
+    for (; index < count; index++) {
+      pixels[index] = blendPixel(color, pixels[index]);
+    }
+  }
+
+  /**
+   * Draws a span of texels sampled from a row of an image, starting at the fixed point
+   * column `u` and moving `uStep` per pixel.
+   */
+  void drawTexturedSpan(std::uint32_t       *pixels,
+                        const int            count,
+                        const std::uint32_t *row,
+                        const int            rowWidth,
+                        std::int64_t         u,
+                        const std::int64_t   uStep,
+                        const std::uint32_t  color,
+                        const bool           blend) {
+    const auto sample = [row, rowWidth](const std::int64_t fixedU) -> std::uint32_t {
+      return row[std::clamp<std::int64_t>(fixedU >> FIXED_SHIFT, 0, rowWidth - 1)];
+    };
+    const bool modulated = color != OPAQUE_WHITE;
+
+    int index = 0;
+#if defined(__SSE2__)
+    const __m128i colorLanes = _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(color)),
+                                                 _mm_setzero_si128());
+    for (; index + 4 <= count; index += 4) {
+      const std::uint32_t first  = sample(u);
+      const std::uint32_t second = sample(u + uStep);
+      const std::uint32_t third  = sample(u + uStep * 2);
+      const std::uint32_t fourth = sample(u + uStep * 3);
+
+      __m128i texels = _mm_set_epi32(static_cast<int>(fourth),
+                                     static_cast<int>(third),
+                                     static_cast<int>(second),
+                                     static_cast<int>(first));
+      if (modulated) {
+        texels = modulate4(texels, colorLanes);
+      }
+      if (blend) {
+        blend4(texels, pixels + index);
+      } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + index), texels);
+      }
+      u += uStep * 4;
+    }
+#endif
+    for (; index < count; index++) {
+      std::uint32_t texel = sample(u);
+      if (modulated) {
+        texel = modulatePixel(texel, color);
+      }
+      pixels[index] = blend ? blendPixel(texel, pixels[index]) : texel;
+      u += uStep;
+    }
+  }
+} // namespace
+
+SoftwareRasterizer::SoftwareRasterizer(JobSystem &jobSystem) :
+    m_jobSystem(jobSystem) {}
+
+void SoftwareRasterizer::resize(const int width, const int height) {
+  if (width == m_width && height == m_height) {
+    return;
+  }
+
+  m_width  = std::max(width, 0);
+  m_height = std::max(height, 0);
+  m_pixels.assign(static_cast<size_t>(m_width) * static_cast<size_t>(m_height), 0);
+  m_quads.clear();
+  m_clearQueued = false;
+}
+
+void SoftwareRasterizer::clear(const std::uint32_t color) {
+  m_quads.clear();
+  m_clearColor  = color;
+  m_clearQueued = true;
+}
+
+void SoftwareRasterizer::addQuad(const Quad &quad) {
+  m_quads.push_back(quad);
+}
+
+void SoftwareRasterizer::flush() {
+  if (m_quads.empty() && !m_clearQueued) {
+    return;
+  }
+
+  const size_t tileCount = static_cast<size_t>((m_height + TILE_HEIGHT - 1) / TILE_HEIGHT);
+  sortQuadsIntoTiles(tileCount);
+
+  const auto drawTiles = [this](const size_t begin, const size_t end) -> void {
+    for (size_t tile = begin; tile < end; tile++) {
+      const int top = static_cast<int>(tile) * TILE_HEIGHT;
+      drawTile(tile, top, std::min(top + TILE_HEIGHT, m_height));
+    }
+  };
+  m_jobSystem.parallelFor(0, tileCount, 1, drawTiles);
+
+  m_quads.clear();
+  m_clearQueued = false;
+}
+
+void SoftwareRasterizer::sortQuadsIntoTiles(const size_t tileCount) {
+  /*
+   * Counts each tile's quads, turns the counts into where each tile's indices start, then
+   * writes every quad's index into the tiles it overlaps, in the order they were queued.
+   * Each tile's start is moved along as its indices are written, ending up at the next
+   * tile's start, so the starts are shifted back by a tile afterwards.
+   */
+  m_tileStarts.assign(tileCount + 1, 0);
+
+  const auto forEachTile = [this](const Quad &quad, const auto &function) -> void {
+    const int top    = std::max(quad.top, 0);
+    const int bottom = std::min(quad.bottom, m_height);
+    if (top >= bottom || quad.right <= std::max(quad.left, 0) || quad.left >= m_width) {
+      return;
+    }
+    for (int tile = top / TILE_HEIGHT; tile <= (bottom - 1) / TILE_HEIGHT; tile++) {
+      function(static_cast<size_t>(tile));
+    }
+  };
+
+  for (const Quad &quad : m_quads) {
+    forEachTile(quad, [this](const size_t tile) -> void { m_tileStarts[tile + 1] += 1; });
+  }
+  for (size_t tile = 0; tile < tileCount; tile++) {
+    m_tileStarts[tile + 1] += m_tileStarts[tile];
+  }
+
+  m_tileQuads.resize(m_tileStarts[tileCount]);
+  for (size_t index = 0; index < m_quads.size(); index++) {
+    forEachTile(m_quads[index], [this, index](const size_t tile) -> void {
+      m_tileQuads[m_tileStarts[tile]] = static_cast<std::uint32_t>(index);
+      m_tileStarts[tile] += 1;
+    });
+  }
+
+  for (size_t tile = tileCount; tile > 0; tile--) {
+    m_tileStarts[tile] = m_tileStarts[tile - 1];
+  }
+  m_tileStarts[0] = 0;
+}
+
+void SoftwareRasterizer::drawTile(const size_t tile, const int top, const int bottom) {
+  if (m_clearQueued) {
+    std::uint32_t *rows = m_pixels.data() + static_cast<size_t>(top) * m_width;
+    fillSpan(rows, (bottom - top) * m_width, m_clearColor);
+  }
+
+  for (size_t slot = m_tileStarts[tile]; slot < m_tileStarts[tile + 1]; slot++) {
+    drawQuad(m_quads[m_tileQuads[slot]], top, bottom);
+  }
+}
+
+void SoftwareRasterizer::drawQuad(const Quad &quad, const int top, const int bottom) {
+  const int left  = std::max(quad.left, 0);
+  const int right = std::min(quad.right, m_width);
+  const int first = std::max(quad.top, top);
+  const int last  = std::min(quad.bottom, bottom);
+  const int count = right - left;
+  if (count <= 0 || first >= last) {
+    return;
+  }
+
+  const std::uint32_t alpha = quad.color >> 24;
+  if (quad.image == nullptr) {
+    if (quad.blend && alpha == 0) {
+      return;
+    }
+
+    for (int y = first; y < last; y++) {
+      std::uint32_t *pixels = m_pixels.data() + static_cast<size_t>(y) * m_width + left;
+      if (quad.blend && alpha != 255) {
+        blendSpan(pixels, count, quad.color);
+      } else {
+        fillSpan(pixels, count, quad.color);
+      }
+    }
+    return;
+  }
+
+  const Image &image = *quad.image;
+  if (image.width <= 0 || image.height <= 0) {
+    return;
+  }
+
+  // Sample at pixel centres, so a quad the size of its texels maps them one to one.
+  const double width   = static_cast<double>(image.width);
+  const double height  = static_cast<double>(image.height);
+  const double uScale  = (quad.texRight - quad.texLeft) * width / (quad.right - quad.left);
+  const double vScale  = (quad.texBottom - quad.texTop) * height / (quad.bottom - quad.top);
+  const double uOrigin = quad.texLeft * width + (left + 0.5 - quad.left) * uScale;
+
+  const auto uStart = static_cast<std::int64_t>(std::floor(uOrigin * FIXED_ONE));
+  const auto uStep  = static_cast<std::int64_t>(std::floor(uScale * FIXED_ONE));
+  for (int y = first; y < last; y++) {
+    const double v   = quad.texTop * height + (y + 0.5 - quad.top) * vScale;
+    const int    row = std::clamp(static_cast<int>(std::floor(v)), 0, image.height - 1);
+
+    drawTexturedSpan(m_pixels.data() + static_cast<size_t>(y) * m_width + left,
+                     count,
+                     image.pixels.data() + static_cast<size_t>(row) * image.width,
+                     image.width,
+                     uStart,
+                     uStep,
+                     quad.color,
+                     quad.blend);
+  }
+}
+
+int SoftwareRasterizer::getWidth() const {
+  return m_width;
+}
+
+int SoftwareRasterizer::getHeight() const {
+  return m_height;
+}
+
+const std::uint32_t *SoftwareRasterizer::getPixels() const {
+  return m_pixels.data();
+}
+
+std::uint32_t SoftwareRasterizer::packColor(const std::uint8_t r,
+                                            const std::uint8_t g,
+                                            const std::uint8_t b,
+                                            const std::uint8_t a) {
+  return static_cast<std::uint32_t>(a) << 24 | static_cast<std::uint32_t>(r) << 16 |
+         static_cast<std::uint32_t>(g) << 8 | static_cast<std::uint32_t>(b);
+}
@@ -4,33 +4,26 @@
 #include "../../includes/Helpers/MathHelpers.hpp"
 
 namespace SpawnHelpers {
-  Vec2 createRandomPosition(std::mt19937 &randomGenerator, const Vec2 &windowSize) {
-    std::uniform_int_distribution<int> randomXPos(0, static_cast<int>(windowSize.x));
-    std::uniform_int_distribution<int> randomYPos(0, static_cast<int>(windowSize.y));
-    const int                          xPos = randomXPos(randomGenerator);
-    const int                          yPos = randomYPos(randomGenerator);
+  Vec2 createRandomPosition(RandomStream &randomStream, const Vec2 &windowSize) {
+    const int xPos = randomStream.nextInt(0, static_cast<int>(windowSize.x));
+    const int yPos = randomStream.nextInt(0, static_cast<int>(windowSize.y));
     return {static_cast<float>(xPos), static_cast<float>(yPos)};
   };
 
-  Vec2 createValidVelocity(std::mt19937 &randomGenerator, const int attempts) {
-    std::uniform_int_distribution<int> randomVel(-1, 1);
-
+  Vec2 createValidVelocity(RandomStream &randomStream) {
     /*
-     * 8/9 chance of generating a valid velocity on the first attempt.
+     * Picks one of the eight non-zero cells of the {-1, 0, 1} grid directly, skipping the
+     * centre, instead of drawing both axes and retrying on (0, 0).
      */
-    const auto velocity = Vec2(static_cast<float>(randomVel(randomGenerator)),
-                               static_cast<float>(randomVel(randomGenerator)))
-                              .normalize();
+    constexpr std::uint32_t DIRECTION_COUNT = 8;
+    constexpr std::uint32_t CENTRE_CELL     = 4;
 
-    /*
-     *  Has a (1/9)^n chance of falling back to the default vector after n attempts.
-     */
-    if (attempts <= 0) {
-      return Vec2(1, 0).normalize();
-    }
+    std::uint32_t cell = randomStream.nextBelow(DIRECTION_COUNT);
+    cell += cell >= CENTRE_CELL ? 1 : 0;
 
-    return (velocity == Vec2(0, 0)) ? createValidVelocity(randomGenerator, attempts - 1)
-                                    : velocity;
+    const auto x = static_cast<float>(static_cast<int>(cell % 3) - 1);
+    const auto y = static_cast<float>(static_cast<int>(cell / 3) - 1);
+    return Vec2(x, y).normalize();
   };
 
   bool validateSpawnPosition(const std::shared_ptr<Entity> &entity,
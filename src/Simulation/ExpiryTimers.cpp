@@ -0,0 +1,125 @@
+#include "../../includes/Simulation/ExpiryTimers.hpp"
+
+#include <algorithm>
+
+bool ExpiryTimers::Timer::operator>(const Timer &other) const {
+  if (deadline != other.deadline) {
+    return deadline > other.deadline;
+  }
+  return sequence > other.sequence;
+}
+
+void ExpiryTimers::scheduleLifespan(const std::shared_ptr<Entity> &entity) {
+  const std::shared_ptr<CLifespan> cLifespan = entity->getComponent<CLifespan>();
+  if (cLifespan == nullptr) {
+    return;
+  }
+
+  m_lifespanTimers.push({
+      .deadline = cLifespan->birthTime + cLifespan->lifespan,
+      .sequence = m_nextSequence++,
+      .entity   = entity,
+      .effect   = {},
+  });
+}
+
+void ExpiryTimers::scheduleEffect(const std::shared_ptr<Entity> &entity,
+                                  const Effect                  &effect) {
+  m_effectTimers.push({
+      .deadline = effect.startTime + effect.duration,
+      .sequence = m_nextSequence++,
+      .entity   = entity,
+      .effect   = effect,
+  });
+}
+
+size_t ExpiryTimers::expireLifespans(const std::uint64_t currentTime) {
+  size_t expiredCount = 0;
+
+  while (!m_lifespanTimers.empty() && m_lifespanTimers.top().deadline < currentTime) {
+    const std::shared_ptr<Entity> entity = m_lifespanTimers.top().entity.lock();
+    m_lifespanTimers.pop();
+
+    if (entity == nullptr || !entity->isActive()) {
+      continue;
+    }
+
+    const std::shared_ptr<CLifespan> cLifespan = entity->getComponent<CLifespan>();
+    if (cLifespan == nullptr) {
+      continue;
+    }
+
+    if (cLifespan->birthTime + cLifespan->lifespan >= currentTime) {
+      scheduleLifespan(entity);
+      continue;
+    }
+
+    entity->destroy();
+    expiredCount += 1;
+  }
+
+  return expiredCount;
+}
+
+size_t ExpiryTimers::expireEffects(const std::uint64_t currentTime) {
+  size_t expiredCount = 0;
+
+  while (!m_effectTimers.empty() && m_effectTimers.top().deadline < currentTime) {
+    const std::shared_ptr<Entity> entity = m_effectTimers.top().entity.lock();
+    const Effect                  effect = m_effectTimers.top().effect;
+    m_effectTimers.pop();
+
+    const std::shared_ptr<CEffects> cEffects =
+        entity != nullptr ? entity->getComponent<CEffects>() : nullptr;
+    if (cEffects == nullptr) {
+      continue;
+    }
+
+    // The effect may have been cleared, or refused because one of its type was active.
+    const bool effectActive = std::ranges::any_of(
+        cEffects->getEffects(), [&effect](const Effect &activeEffect) -> bool {
+          return activeEffect.type == effect.type &&
+                 activeEffect.startTime == effect.startTime &&
+                 activeEffect.duration == effect.duration;
+        });
+    if (!effectActive) {
+      continue;
+    }
+
+    cEffects->removeEffect(effect.type);
+    expiredCount += 1;
+  }
+
+  return expiredCount;
+}
+
+void ExpiryTimers::rebuild(EntityManager &entityManager) {
+  m_lifespanTimers = {};
+  m_effectTimers   = {};
+
+  auto scheduleEntity = [this](const std::shared_ptr<Entity> &entity) -> void {
+    scheduleLifespan(entity);
+    if (const std::shared_ptr<CEffects> cEffects = entity->getComponent<CEffects>()) {
+      for (const Effect &effect : cEffects->getEffects()) {
+        scheduleEffect(entity, effect);
+      }
+    }
+  };
+
+  for (const std::shared_ptr<Entity> &entity : entityManager.getEntities()) {
+    scheduleEntity(entity);
+  }
+  for (const std::shared_ptr<Entity> &entity : entityManager.getPendingEntities()) {
+    scheduleEntity(entity);
+  }
+}
+
+void ExpiryTimers::clear() {
+  m_lifespanTimers.clear();
+  m_effectTimers.clear();
+  m_nextSequence = 0;
+}
+
+size_t ExpiryTimers::getTimerCount() const {
+  return m_lifespanTimers.size() + m_effectTimers.size();
+}
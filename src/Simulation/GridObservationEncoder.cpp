@@ -0,0 +1,163 @@
+#include "../../includes/Simulation/GridObservationEncoder.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+  template <typename T> struct GridValue;
+
+  template <> struct GridValue<float> {
+    static constexpr float OCCUPIED = 1.0f;
+
+    static float velocity(const float normalizedVelocity) {
+      return std::clamp(normalizedVelocity, -1.0f, 1.0f);
+    }
+  };
+
+  template <> struct GridValue<std::uint8_t> {
+    static constexpr std::uint8_t OCCUPIED = 255;
+
+    static std::uint8_t velocity(const float normalizedVelocity) {
+      constexpr float ZERO  = 128.0f;
+      constexpr float RANGE = 127.0f;
+      const float     value = ZERO + std::clamp(normalizedVelocity, -1.0f, 1.0f) * RANGE;
+      return static_cast<std::uint8_t>(std::lround(value));
+    }
+  };
+} // namespace
+
+GridObservationEncoder::GridObservationEncoder(const size_t width,
+                                               const size_t height,
+                                               const bool   includeVelocity,
+                                               const float  velocityScale) :
+    m_width(width),
+    m_height(height),
+    m_includeVelocity(includeVelocity),
+    m_velocityScale(velocityScale) {
+  if (width == 0 || height == 0) {
+    throw std::runtime_error("The observation grid must be at least one cell wide and tall");
+  }
+
+  // Velocities are divided by the scale, so zero would fill the tensor with infinities.
+  if (!(velocityScale > 0) || !std::isfinite(velocityScale)) {
+    throw std::runtime_error("The observation velocity scale must be positive and finite");
+  }
+}
+
+size_t GridObservationEncoder::getWidth() const {
+  return m_width;
+}
+
+size_t GridObservationEncoder::getHeight() const {
+  return m_height;
+}
+
+size_t GridObservationEncoder::getChannelCount() const {
+  return TAG_CHANNEL_COUNT + (m_includeVelocity ? 2 : 0);
+}
+
+size_t GridObservationEncoder::getBufferSize() const {
+  return getChannelCount() * m_width * m_height;
+}
+
+void GridObservationEncoder::gather(EntityManager &entityManager, const Vec2 &worldSize) {
+  m_cellLeft.clear();
+  m_cellTop.clear();
+  m_cellRight.clear();
+  m_cellBottom.clear();
+  m_channels.clear();
+  m_velocityX.clear();
+  m_velocityY.clear();
+
+  if (worldSize.x <= 0 || worldSize.y <= 0) {
+    return;
+  }
+
+  const float columnsPerUnit = static_cast<float>(m_width) / worldSize.x;
+  const float rowsPerUnit    = static_cast<float>(m_height) / worldSize.y;
+  const float width          = static_cast<float>(m_width);
+  const float height         = static_cast<float>(m_height);
+
+  for (const std::shared_ptr<Entity> &entity : entityManager.getEntities()) {
+    if (!entity->isActive()) {
+      continue;
+    }
+
+    const auto &cTransform = entity->getComponent<CTransform>();
+    const auto &cShape     = entity->getComponent<CShape>();
+    if (cTransform == nullptr || cShape == nullptr) {
+      continue;
+    }
+
+    const Vec2 &position = cTransform->topLeftCornerPos;
+
+    const float left   = std::floor(position.x * columnsPerUnit);
+    const float top    = std::floor(position.y * rowsPerUnit);
+    const float right  = std::ceil((position.x + static_cast<float>(cShape->rect.w)) *
+                                  columnsPerUnit);
+    const float bottom = std::ceil((position.y + static_cast<float>(cShape->rect.h)) *
+                                   rowsPerUnit);
+
+    const auto cellLeft   = static_cast<std::int32_t>(std::clamp(left, 0.0f, width));
+    const auto cellTop    = static_cast<std::int32_t>(std::clamp(top, 0.0f, height));
+    const auto cellRight  = static_cast<std::int32_t>(std::clamp(right, 0.0f, width));
+    const auto cellBottom = static_cast<std::int32_t>(std::clamp(bottom, 0.0f, height));
+
+    // Entirely outside the grid, or zero-sized.
+    if (cellRight <= cellLeft || cellBottom <= cellTop) {
+      continue;
+    }
+
+    m_cellLeft.push_back(cellLeft);
+    m_cellTop.push_back(cellTop);
+    m_cellRight.push_back(cellRight);
+    m_cellBottom.push_back(cellBottom);
+    m_channels.push_back(static_cast<std::uint8_t>(entity->tag()));
+    m_velocityX.push_back(cTransform->velocity.x / m_velocityScale);
+    m_velocityY.push_back(cTransform->velocity.y / m_velocityScale);
+  }
+}
+
+template <typename T> void GridObservationEncoder::rasterize(T *output) const {
+  const size_t planeSize = m_width * m_height;
+  std::fill(output, output + getBufferSize(), T{0});
+
+  T *velocityXPlane = output + TAG_CHANNEL_COUNT * planeSize;
+  T *velocityYPlane = velocityXPlane + planeSize;
+
+  for (size_t i = 0; i < m_channels.size(); i++) {
+    T      *plane     = output + m_channels[i] * planeSize;
+    const T velocityX = GridValue<T>::velocity(m_velocityX[i]);
+    const T velocityY = GridValue<T>::velocity(m_velocityY[i]);
+
+    // Rows of a box are contiguous within each plane, so every row is a single fill.
+    for (std::int32_t row = m_cellTop[i]; row < m_cellBottom[i]; row++) {
+      const size_t begin = static_cast<size_t>(row) * m_width + m_cellLeft[i];
+      const size_t end   = static_cast<size_t>(row) * m_width + m_cellRight[i];
+
+      std::fill(plane + begin, plane + end, GridValue<T>::OCCUPIED);
+
+      if (!m_includeVelocity) {
+        continue;
+      }
+
+      std::fill(velocityXPlane + begin, velocityXPlane + end, velocityX);
+      std::fill(velocityYPlane + begin, velocityYPlane + end, velocityY);
+    }
+  }
+}
+
+void GridObservationEncoder::encode(EntityManager &entityManager,
+                                    const Vec2    &worldSize,
+                                    float         *output) {
+  gather(entityManager, worldSize);
+  rasterize(output);
+}
+
+void GridObservationEncoder::encode(EntityManager &entityManager,
+                                    const Vec2    &worldSize,
+                                    std::uint8_t  *output) {
+  gather(entityManager, worldSize);
+  rasterize(output);
+}
@@ -0,0 +1,277 @@
+#include "../../includes/Simulation/InputRecording.hpp"
+#include "../../includes/Helpers/BinaryIO.hpp"
+
+#include <algorithm>
+
+namespace {
+  constexpr std::uint32_t RECORDING_MAGIC   = 0x52425259; // "YRBR"
+  constexpr std::uint16_t RECORDING_VERSION = 3;
+
+  constexpr std::uint8_t ACTION_STARTED          = 1 << 0;
+  constexpr std::uint8_t ACTION_HAS_POSITION     = 1 << 1;
+  constexpr std::uint8_t ACTION_HAS_SPAWN_BUDGET = 1 << 2;
+
+  // Recorded changes to the window or the spawn budget rather than player input.
+  bool isConfigAction(const RecordedAction &action) {
+    return action.name == InputRecording::WINDOW_RESIZE_ACTION ||
+           action.name == InputRecording::SPAWN_BUDGET_ACTION;
+  }
+} // namespace
+
+RecordingSummary RecordingSummary::capture(MainSceneSimulation &simulation) {
+  return {
+      .tickCount   = simulation.getTick(),
+      .score       = simulation.getScore(),
+      .lives       = simulation.getLives(),
+      .entityCount = simulation.getEntityManager().getEntities().size(),
+  };
+}
+
+std::vector<std::uint8_t> InputRecording::serialize() const {
+  std::vector<std::string> names;
+  for (const RecordedAction &action : actions) {
+    if (std::find(names.begin(), names.end(), action.name) == names.end()) {
+      names.push_back(action.name);
+    }
+  }
+
+  BinaryWriter writer;
+  writer.writeU32(RECORDING_MAGIC);
+  writer.writeU16(RECORDING_VERSION);
+  writer.writeU32(seed);
+  writer.writeVarint(tickDuration);
+  writer.writeVec2(windowSize);
+
+  writer.writeVarint(names.size());
+  for (const std::string &name : names) {
+    writer.writeString(name);
+  }
+
+  writer.writeVarint(actions.size());
+  std::uint64_t previousTick = 0;
+  for (const RecordedAction &action : actions) {
+    const auto nameIndex = std::find(names.begin(), names.end(), action.name) - names.begin();
+
+    std::uint8_t flags = 0;
+    flags |= action.state == START ? ACTION_STARTED : 0;
+    flags |= action.position.has_value() ? ACTION_HAS_POSITION : 0;
+    flags |= action.spawnBudget.has_value() ? ACTION_HAS_SPAWN_BUDGET : 0;
+
+    writer.writeVarint(action.tick - previousTick);
+    writer.writeVarint(static_cast<std::uint64_t>(nameIndex));
+    writer.writeU8(flags);
+    if (action.position.has_value()) {
+      writer.writeVec2(*action.position);
+    }
+    if (action.spawnBudget.has_value()) {
+      writer.writeU8(action.spawnBudget->spawnPercentage);
+      writer.writeU8(action.spawnBudget->cullCount);
+    }
+    previousTick = action.tick;
+  }
+
+  writer.writeVarint(summary.tickCount);
+  writer.writeSignedVarint(summary.score);
+  writer.writeSignedVarint(summary.lives);
+  writer.writeVarint(summary.entityCount);
+
+  return writer.getBuffer();
+}
+
+InputRecording InputRecording::deserialize(const std::vector<std::uint8_t> &bytes) {
+  BinaryReader reader(bytes);
+
+  if (reader.readU32() != RECORDING_MAGIC) {
+    throw BinaryFormatError("Not an input recording");
+  }
+
+  const std::uint16_t version = reader.readU16();
+  if (version != RECORDING_VERSION) {
+    throw BinaryFormatError("Unsupported input recording version " + std::to_string(version));
+  }
+
+  InputRecording recording;
+  recording.seed         = reader.readU32();
+  recording.tickDuration = reader.readVarint();
+  recording.windowSize   = reader.readVec2();
+
+  std::vector<std::string> names(reader.readVarint());
+  for (std::string &name : names) {
+    name = reader.readString();
+  }
+
+  const std::uint64_t actionCount  = reader.readVarint();
+  std::uint64_t       previousTick = 0;
+  for (std::uint64_t i = 0; i < actionCount; i++) {
+    RecordedAction action;
+    action.tick = previousTick + reader.readVarint();
+
+    const std::uint64_t nameIndex = reader.readVarint();
+    if (nameIndex >= names.size()) {
+      throw BinaryFormatError("Input recording references an unknown action name");
+    }
+    action.name = names[nameIndex];
+
+    const std::uint8_t flags = reader.readU8();
+    action.state             = (flags & ACTION_STARTED) != 0 ? START : END;
+    if ((flags & ACTION_HAS_POSITION) != 0) {
+      action.position = reader.readVec2();
+    }
+    if ((flags & ACTION_HAS_SPAWN_BUDGET) != 0) {
+      const std::uint8_t spawnPercentage = reader.readU8();
+      const std::uint8_t cullCount       = reader.readU8();
+      action.spawnBudget = {.spawnPercentage = spawnPercentage, .cullCount = cullCount};
+    }
+
+    previousTick = action.tick;
+    recording.actions.push_back(std::move(action));
+  }
+
+  recording.summary.tickCount   = reader.readVarint();
+  recording.summary.score       = static_cast<int>(reader.readSignedVarint());
+  recording.summary.lives       = static_cast<int>(reader.readSignedVarint());
+  recording.summary.entityCount = reader.readVarint();
+
+  return recording;
+}
+
+void InputRecording::save(const std::filesystem::path &path) const {
+  BinaryHelpers::writeFile(path, serialize());
+}
+
+InputRecording InputRecording::load(const std::filesystem::path &path) {
+  return deserialize(BinaryHelpers::readFile(path));
+}
+
+InputRecorder::InputRecorder(const std::uint32_t seed, const Vec2 &windowSize) {
+  m_recording.seed       = seed;
+  m_recording.windowSize = windowSize;
+}
+
+void InputRecorder::record(const MainSceneSimulation &simulation, const Action &action) {
+  m_recording.actions.push_back({
+      .tick        = simulation.getTick(),
+      .name        = action.getName(),
+      .state       = action.getState(),
+      .position    = action.getPos(),
+      .spawnBudget = std::nullopt,
+  });
+}
+
+void InputRecorder::recordWindowResize(const MainSceneSimulation &simulation,
+                                       const Vec2                &windowSize) {
+  m_recording.actions.push_back({
+      .tick        = simulation.getTick(),
+      .name        = InputRecording::WINDOW_RESIZE_ACTION,
+      .state       = START,
+      .position    = windowSize,
+      .spawnBudget = std::nullopt,
+  });
+}
+
+void InputRecorder::recordSpawnBudget(const MainSceneSimulation              &simulation,
+                                      const MainSceneSimulation::SpawnBudget &spawnBudget) {
+  m_recording.actions.push_back({
+      .tick        = simulation.getTick(),
+      .name        = InputRecording::SPAWN_BUDGET_ACTION,
+      .state       = START,
+      .position    = std::nullopt,
+      .spawnBudget = spawnBudget,
+  });
+}
+
+void InputRecorder::discardFrom(const std::uint64_t tick) {
+  std::erase_if(m_recording.actions,
+                [tick](const RecordedAction &action) { return action.tick >= tick; });
+}
+
+Vec2 InputRecorder::getWindowSize() const {
+  const std::vector<RecordedAction> &actions = m_recording.actions;
+
+  const auto isResize = [](const RecordedAction &action) -> bool {
+    return action.name == InputRecording::WINDOW_RESIZE_ACTION && action.position.has_value();
+  };
+  const auto resize = std::find_if(actions.rbegin(), actions.rend(), isResize);
+  return resize != actions.rend() ? *resize->position : m_recording.windowSize;
+}
+
+void InputRecorder::finish(MainSceneSimulation &simulation) {
+  m_recording.summary = RecordingSummary::capture(simulation);
+}
+
+const InputRecording &InputRecorder::getRecording() const {
+  return m_recording;
+}
+
+InputReplayer::InputReplayer(const InputRecording &recording) :
+    m_recording(recording) {}
+
+bool InputReplayer::applyActions(MainSceneSimulation &simulation) {
+  const std::vector<RecordedAction> &actions = m_recording.actions;
+
+  while (m_nextAction < actions.size() && actions[m_nextAction].tick <= simulation.getTick()) {
+    const RecordedAction &recordedAction = actions[m_nextAction];
+    if (isConfigAction(recordedAction)) {
+      return false;
+    }
+    m_nextAction += 1;
+
+    const Action action(recordedAction.name, recordedAction.state, recordedAction.position);
+    simulation.sDoAction(action);
+  }
+  return true;
+}
+
+void InputReplayer::applyConfigActions(MainSceneSimulation &simulation,
+                                       ConfigManager       &configManager) {
+  const std::vector<RecordedAction> &actions = m_recording.actions;
+
+  while (m_nextAction < actions.size() && actions[m_nextAction].tick <= simulation.getTick() &&
+         isConfigAction(actions[m_nextAction])) {
+    const RecordedAction &recordedAction = actions[m_nextAction];
+    m_nextAction += 1;
+
+    if (recordedAction.position.has_value()) {
+      configManager.updateGameWindowSize(*recordedAction.position);
+      simulation.onWindowResize();
+    }
+    if (recordedAction.spawnBudget.has_value()) {
+      simulation.setSpawnBudget(*recordedAction.spawnBudget);
+    }
+  }
+}
+
+bool InputReplayer::isFinished(const MainSceneSimulation &simulation) const {
+  return simulation.isGameOver() || simulation.getTick() >= m_recording.summary.tickCount;
+}
+
+void InputReplayer::seek(const std::uint64_t tick) {
+  const std::vector<RecordedAction> &actions = m_recording.actions;
+
+  const auto next = std::ranges::lower_bound(actions, tick, {}, &RecordedAction::tick);
+  m_nextAction = static_cast<size_t>(next - actions.begin());
+}
+
+RecordingSummary InputReplayer::run(const InputRecording &recording,
+                                    ConfigManager        &configManager,
+                                    const TickCallback   &onTick) {
+  // The player and walls are placed from the window size when the simulation is created.
+  configManager.updateGameWindowSize(recording.windowSize);
+
+  MainSceneSimulation simulation(configManager, recording.seed);
+  InputReplayer       replayer(recording);
+
+  while (!replayer.isFinished(simulation)) {
+    while (!replayer.applyActions(simulation)) {
+      replayer.applyConfigActions(simulation, configManager);
+    }
+    simulation.update(recording.tickDuration);
+    simulation.clearEvents();
+
+    if (onTick) {
+      onTick(simulation);
+    }
+  }
+
+  return RecordingSummary::capture(simulation);
+}
@@ -0,0 +1,472 @@
+#include "../../includes/Simulation/MainSceneSimulation.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
+#include "../../includes/Helpers/MovementHelpers.hpp"
+#include "../../includes/Helpers/Profiler.hpp"
+#include "../../includes/Helpers/Vec2.hpp"
+#include "../../includes/Simulation/SimulationSnapshot.hpp"
+
+#include <algorithm>
+#include <array>
+
+MainSceneSimulation::MainSceneSimulation(ConfigManager      &configManager,
+                                         const std::uint32_t seed) :
+    m_configManager(configManager),
+    m_random(seed, m_tick),
+    m_spawner(m_random, configManager, m_entities, m_currentTime, m_expiryTimers) {
+  m_player = m_spawner.spawnPlayer();
+  LogHelpers::logInfo("spawned the player");
+  m_spawner.spawnWalls();
+  m_initialEntityCount = m_entities.getTotalEntities();
+}
+
+void MainSceneSimulation::reset(const std::uint32_t seed) {
+  m_currentTime                  = 0;
+  m_tick                         = 0;
+  m_lastNonPlayerEntitySpawnTime = 0;
+  m_deltaTime                    = 0;
+  m_score                        = 0;
+  m_lives                        = STARTING_LIVES;
+  m_timeRemaining                = ROUND_DURATION;
+  m_gameOver                     = false;
+  m_lastBulletSpawnTime          = 0;
+  m_bulletSpawnCooldown          = BULLET_SPAWN_COOLDOWN;
+  m_tickStats                    = {};
+  m_spawnBudget                  = {};
+  m_random.setSeed(seed);
+  m_expiryTimers.clear();
+  m_events.clear();
+
+  if (m_entities.truncate(m_initialEntityCount)) {
+    m_spawner.resetPlayer(m_player);
+    return;
+  }
+
+  // Walls rebuilt for a resized window have later ids, so the round starts from scratch.
+  m_entities.clear();
+  m_player = m_spawner.spawnPlayer();
+  m_spawner.spawnWalls();
+  m_initialEntityCount = m_entities.getTotalEntities();
+}
+
+void MainSceneSimulation::update(const std::uint64_t deltaTime) {
+  if (m_gameOver) {
+    return;
+  }
+
+  beginTick(deltaTime);
+
+  sMovement();
+  sCollision();
+  sSpawner();
+  sLifespan();
+  sEffects();
+  sTimer(deltaTime);
+}
+
+void MainSceneSimulation::beginTick(const std::uint64_t deltaTime) {
+  m_currentTime += deltaTime;
+  m_tick += 1;
+  m_deltaTime = static_cast<float>(deltaTime) / 1000.0f;
+  m_tickStats = {};
+}
+
+void MainSceneSimulation::sDoAction(const Action &action) {
+  if (m_player == nullptr) {
+    LogHelpers::logError("Player entity is null, cannot process action.");
+    return;
+  }
+
+  const ActionState &actionState = action.getState();
+
+  const auto &cInput = m_player->getComponent<CInput>();
+
+  if (cInput == nullptr) {
+    LogHelpers::logError("Player entity lacks an input component.");
+    return;
+  }
+
+  bool &forward  = cInput->forward;
+  bool &backward = cInput->backward;
+  bool &left     = cInput->left;
+  bool &right    = cInput->right;
+
+  const bool actionStateStart = actionState == ActionState::START;
+
+  if (action.getName() == "FORWARD") {
+    forward = actionStateStart;
+  }
+  if (action.getName() == "BACKWARD") {
+    backward = actionStateStart;
+  }
+  if (action.getName() == "LEFT") {
+    left = actionStateStart;
+  }
+  if (action.getName() == "RIGHT") {
+    right = actionStateStart;
+  }
+
+  if (!actionStateStart) {
+    return;
+  }
+
+  if (action.getName() == "SHOOT") {
+    const bool spawnBullet = m_currentTime - m_lastBulletSpawnTime > m_bulletSpawnCooldown;
+    if (!spawnBullet) {
+      return;
+    }
+
+    const std::optional<Vec2> position = action.getPos();
+    if (!position.has_value()) {
+      LogHelpers::logError("A mouse event was called without a position.");
+      return;
+    }
+    const Vec2 mousePosition = *position;
+
+    m_events.push_back({.type = GameEventType::SHOOT, .position = m_player->getCenterPos()});
+    m_spawner.spawnBullets(m_player, mousePosition);
+    m_lastBulletSpawnTime = m_currentTime;
+  }
+}
+
+void MainSceneSimulation::sCollision() {
+  PROFILE_ZONE("sCollision");
+  using namespace CollisionHelpers::MainScene;
+  const Vec2 &windowSize = m_configManager.getGameConfig().windowSize;
+
+  const GameState gameState = {
+      .entityManager   = m_entities,
+      .random          = m_random,
+      .score           = m_score,
+      .setScore        = [this](const int score) -> void { setScore(score); },
+      .decrementLives  = [this]() -> void { decrementLives(); },
+      .events          = m_events,
+      .windowSize      = windowSize,
+      .currentTime     = m_currentTime,
+      .expiryTimers    = m_expiryTimers,
+  };
+
+  const size_t entityCount = m_entities.getEntities().size();
+  m_tickStats.collisionChecks += static_cast<std::uint32_t>(entityCount * entityCount);
+
+  for (auto &entity : m_entities.getEntities()) {
+    handleEntityBounds(entity, windowSize);
+    for (auto &otherEntity : m_entities.getEntities()) {
+      const CollisionPair collisionPair = {.entityA = entity, .entityB = otherEntity};
+      if (handleEntityEntityCollision(collisionPair, gameState)) {
+        m_tickStats.collisions += 1;
+      }
+    }
+  }
+
+  m_entities.update();
+}
+
+void MainSceneSimulation::sMovement() {
+  PROFILE_ZONE("sMovement");
+  const ConfigManager        &configManager          = m_configManager;
+  const PlayerConfig         &playerConfig           = configManager.getPlayerConfig();
+  const EnemyConfig          &enemyConfig            = configManager.getEnemyConfig();
+  const SlownessEffectConfig &slownessEffectConfig   = configManager.getSlownessEffectConfig();
+  const SpeedEffectConfig    &speedBoostEffectConfig = configManager.getSpeedEffectConfig();
+
+  const EntityVector &entities = m_entities.getEntities();
+
+  // Each entity moves by its own components alone, so ranges of entities can move in parallel.
+  const auto moveEntities = [&](const size_t begin, const size_t end) {
+    for (size_t index = begin; index < end; index++) {
+      const std::shared_ptr<Entity> &entity = entities[index];
+      MovementHelpers::moveSpeedBoosts(entity, speedBoostEffectConfig, m_deltaTime);
+      MovementHelpers::moveEnemies(entity, enemyConfig, m_deltaTime);
+      MovementHelpers::movePlayer(entity, playerConfig, m_deltaTime);
+      MovementHelpers::moveSlownessDebuffs(entity, slownessEffectConfig, m_deltaTime);
+      MovementHelpers::moveBullets(entity, m_deltaTime);
+      MovementHelpers::moveItems(entity, m_deltaTime, m_currentTime);
+    }
+  };
+
+  if (m_jobSystem == nullptr) {
+    moveEntities(0, entities.size());
+    return;
+  }
+
+  constexpr size_t MOVEMENT_GRAIN_SIZE = 64;
+  m_jobSystem->parallelFor(0, entities.size(), MOVEMENT_GRAIN_SIZE, moveEntities);
+}
+
+void MainSceneSimulation::sSpawner() {
+  PROFILE_ZONE("sSpawner");
+  const std::uint64_t SPAWN_INTERVAL = m_configManager.getGameConfig().spawnInterval;
+
+  if (m_spawnBudget.cullCount > 0) {
+    cullLowValueEntities(m_spawnBudget.cullCount);
+    m_spawnBudget.cullCount = 0;
+  }
+
+  // A spent budget defers the round, which then runs as soon as the budget allows.
+  if (m_currentTime - m_lastNonPlayerEntitySpawnTime < SPAWN_INTERVAL ||
+      m_spawnBudget.spawnPercentage == 0) {
+    return;
+  }
+
+  m_lastNonPlayerEntitySpawnTime = m_currentTime;
+
+  const EnemyConfig          &enemyCfg       = m_configManager.getEnemyConfig();
+  const SpeedEffectConfig    &speedEffectCfg = m_configManager.getSpeedEffectConfig();
+  const SlownessEffectConfig &slowEffectCfg  = m_configManager.getSlownessEffectConfig();
+  const ItemConfig           &itemCfg        = m_configManager.getItemConfig();
+
+  const auto &cEffects           = m_player->getComponent<CEffects>();
+  const bool hasSpeedBasedEffect = cEffects->hasEffect(Speed) || cEffects->hasEffect(Slowness);
+
+  const unsigned int spawnPercentage = m_spawnBudget.spawnPercentage;
+
+  // Each kind of entity rolls from its own stream, so skipping one roll does not shift others.
+  auto shouldSpawn = [this, spawnPercentage](const EntityTags tag,
+                                             const unsigned int chance) -> bool {
+    RandomStream roll = m_random.getStream(RandomStreamId::SPAWN_ROLLS,
+                                           static_cast<std::uint64_t>(tag));
+    return static_cast<unsigned int>(roll.nextInt(0, 100)) < chance * spawnPercentage / 100;
+  };
+
+  const bool spawnEnemy = shouldSpawn(EntityTags::Enemy, enemyCfg.spawnPercentage);
+  const bool spawnSpeedBoost =
+      !hasSpeedBasedEffect &&
+      shouldSpawn(EntityTags::SpeedBoost, speedEffectCfg.spawnPercentage);
+  const bool spawnSlowDebuff =
+      !hasSpeedBasedEffect &&
+      shouldSpawn(EntityTags::SlownessDebuff, slowEffectCfg.spawnPercentage);
+  const bool spawnItem = shouldSpawn(EntityTags::Item, itemCfg.spawnPercentage);
+
+  auto trySpawn = [this](const bool spawned) -> void {
+    m_tickStats.spawnAttempts += 1;
+    m_tickStats.spawns += spawned ? 1 : 0;
+  };
+
+  if (spawnEnemy) {
+    trySpawn(m_spawner.spawnEnemy(m_player));
+  }
+
+  if (spawnSpeedBoost) {
+    trySpawn(m_spawner.spawnSpeedBoostEntity(m_player));
+  }
+
+  if (spawnSlowDebuff) {
+    trySpawn(m_spawner.spawnSlownessEntity(m_player));
+  }
+
+  if (spawnItem) {
+    trySpawn(m_spawner.spawnItem(m_player));
+  }
+}
+
+void MainSceneSimulation::cullLowValueEntities(const size_t count) {
+  constexpr std::array CULL_ORDER = {
+      EntityTags::SlownessDebuff,
+      EntityTags::SpeedBoost,
+      EntityTags::Enemy,
+  };
+
+  size_t culled = 0;
+  for (const EntityTags tag : CULL_ORDER) {
+    culled += destroyOldest(tag, count - culled);
+  }
+
+  m_entities.update();
+  m_tickStats.culled += static_cast<std::uint32_t>(culled);
+}
+
+size_t MainSceneSimulation::destroyOldest(const EntityTags tag, const size_t count) {
+  // Ids are assigned in creation order, so the lowest ids are the oldest entities.
+  EntityVector candidates = m_entities.getEntities(tag);
+  std::ranges::sort(candidates, {}, &Entity::id);
+
+  size_t destroyed = 0;
+  for (const std::shared_ptr<Entity> &entity : candidates) {
+    if (destroyed == count) {
+      break;
+    }
+    if (!entity->isActive()) {
+      continue;
+    }
+    entity->destroy();
+    destroyed += 1;
+  }
+  return destroyed;
+}
+
+void MainSceneSimulation::spawnUnchecked(const EntityTags tag, const size_t count) {
+  for (size_t index = 0; index < count; index++) {
+    if (m_spawner.spawnUnchecked(tag) == nullptr) {
+      LogHelpers::logError("Entities with tag %d cannot be spawned unchecked", tag);
+      return;
+    }
+  }
+  m_entities.update();
+}
+
+void MainSceneSimulation::sEffects() {
+  PROFILE_ZONE("sEffects");
+  m_expiryTimers.expireEffects(m_currentTime);
+}
+
+void MainSceneSimulation::sTimer(const std::uint64_t deltaTime) {
+  PROFILE_ZONE("sTimer");
+  if (m_timeRemaining < deltaTime) {
+    m_timeRemaining = 0;
+    setGameOver();
+    return;
+  }
+
+  m_timeRemaining -= deltaTime;
+}
+
+void MainSceneSimulation::sLifespan() {
+  PROFILE_ZONE("sLifespan");
+  // Fading out is computed from the lifespan at draw time.
+  m_expiryTimers.expireLifespans(m_currentTime);
+}
+
+void MainSceneSimulation::onWindowResize() {
+  const auto walls = m_entities.getEntities(EntityTags::Wall);
+  for (const auto &wall : walls) {
+    wall->destroy();
+  }
+
+  m_entities.update();
+
+  m_spawner.spawnWalls();
+}
+
+void MainSceneSimulation::setSpawnBudget(const SpawnBudget &spawnBudget) {
+  m_spawnBudget                 = spawnBudget;
+  m_spawnBudget.spawnPercentage = std::min<std::uint8_t>(spawnBudget.spawnPercentage, 100);
+}
+
+void MainSceneSimulation::setJobSystem(JobSystem *jobSystem) {
+  m_jobSystem = jobSystem;
+}
+
+void MainSceneSimulation::saveSnapshot(BinaryWriter &writer) const {
+  SimulationSnapshot::writeHeader(writer);
+
+  writer.writeVarint(m_currentTime);
+  writer.writeVarint(m_tick);
+  writer.writeVarint(m_lastNonPlayerEntitySpawnTime);
+  writer.writeFloat(m_deltaTime);
+  writer.writeSignedVarint(m_score);
+  writer.writeSignedVarint(m_lives);
+  writer.writeVarint(m_timeRemaining);
+  writer.writeU8(m_gameOver ? 1 : 0);
+  writer.writeVarint(m_lastBulletSpawnTime);
+  writer.writeVarint(m_bulletSpawnCooldown);
+  writer.writeU8(m_spawnBudget.spawnPercentage);
+  writer.writeU8(m_spawnBudget.cullCount);
+  writer.writeU32(m_random.getSeed());
+
+  writer.writeVarint(m_player->id());
+  SimulationSnapshot::writeEntities(writer, m_entities);
+}
+
+void MainSceneSimulation::restoreSnapshot(BinaryReader &reader) {
+  SimulationSnapshot::readHeader(reader);
+
+  m_currentTime                  = reader.readVarint();
+  m_tick                         = reader.readVarint();
+  m_lastNonPlayerEntitySpawnTime = reader.readVarint();
+  m_deltaTime                    = reader.readFloat();
+  m_score                        = static_cast<int>(reader.readSignedVarint());
+  m_lives                        = static_cast<int>(reader.readSignedVarint());
+  m_timeRemaining                = reader.readVarint();
+  m_gameOver                     = reader.readU8() != 0;
+  m_lastBulletSpawnTime          = reader.readVarint();
+  m_bulletSpawnCooldown          = reader.readVarint();
+  m_spawnBudget.spawnPercentage  = reader.readU8();
+  m_spawnBudget.cullCount        = reader.readU8();
+  m_random.setSeed(reader.readU32());
+
+  const auto playerId = static_cast<size_t>(reader.readVarint());
+  SimulationSnapshot::readEntities(reader, m_entities);
+
+  m_player = nullptr;
+  for (const std::shared_ptr<Entity> &entity : m_entities.getEntities(EntityTags::Player)) {
+    if (entity->id() == playerId) {
+      m_player = entity;
+    }
+  }
+  if (m_player == nullptr) {
+    throw BinaryFormatError("Snapshot does not contain the player entity");
+  }
+
+  m_expiryTimers.rebuild(m_entities);
+
+  m_events.clear();
+}
+
+void MainSceneSimulation::setGameOver() {
+  m_gameOver = true;
+}
+
+bool MainSceneSimulation::isGameOver() const {
+  return m_gameOver;
+}
+
+void MainSceneSimulation::setScore(const int score) {
+  m_score = score;
+  if (m_score < 0) {
+    m_score = 0;
+    setGameOver();
+  }
+}
+
+int MainSceneSimulation::getScore() const {
+  return m_score;
+}
+
+int MainSceneSimulation::getLives() const {
+  return m_lives;
+}
+
+void MainSceneSimulation::decrementLives() {
+  if (m_lives > 0) {
+    m_lives--;
+    return;
+  }
+  setGameOver();
+}
+
+std::uint64_t MainSceneSimulation::getCurrentTime() const {
+  return m_currentTime;
+}
+
+std::uint64_t MainSceneSimulation::getTick() const {
+  return m_tick;
+}
+
+std::uint64_t MainSceneSimulation::getTimeRemaining() const {
+  return m_timeRemaining;
+}
+
+EntityManager &MainSceneSimulation::getEntityManager() {
+  return m_entities;
+}
+
+const std::shared_ptr<Entity> &MainSceneSimulation::getPlayer() const {
+  return m_player;
+}
+
+const MainSceneSimulation::TickStats &MainSceneSimulation::getTickStats() const {
+  return m_tickStats;
+}
+
+const MainSceneSimulation::SpawnBudget &MainSceneSimulation::getSpawnBudget() const {
+  return m_spawnBudget;
+}
+
+const std::vector<GameEvent> &MainSceneSimulation::getEvents() const {
+  return m_events;
+}
+
+void MainSceneSimulation::clearEvents() {
+  m_events.clear();
+}
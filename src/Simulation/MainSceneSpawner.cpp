@@ -1,37 +1,41 @@
-#include "../../../includes/GameScenes/MainScene/MainSceneSpawner.hpp"
-#include "../../../includes/Helpers/CollisionHelpers.hpp"
-#include "../../../includes/Helpers/SpawnHelpers.hpp"
-MainSceneSpawner::MainSceneSpawner(std::mt19937   &randomGenerator,
-                                   ConfigManager  &configManager,
-                                   TextureManager &textureManager,
-                                   EntityManager  &entityManager,
-                                   SDL_Renderer   *renderer) :
-    m_randomGenerator(randomGenerator),
+#include "../../includes/Simulation/MainSceneSpawner.hpp"
+#include "../../includes/Helpers/CollisionHelpers.hpp"
+#include "../../includes/Helpers/LogHelpers.hpp"
+#include "../../includes/Helpers/SpawnHelpers.hpp"
+MainSceneSpawner::MainSceneSpawner(const SimulationRandom &random,
+                                   ConfigManager          &configManager,
+                                   EntityManager          &entityManager,
+                                   const std::uint64_t    &currentTime,
+                                   ExpiryTimers           &expiryTimers) :
+    m_random(random),
     m_configManager(configManager),
-    m_textureManager(textureManager),
     m_entityManager(entityManager),
-    m_renderer(renderer) {
-  std::cout << "spawner created\n";
+    m_currentTime(currentTime),
+    m_expiryTimers(expiryTimers) {
+  LogHelpers::logInfo("spawner created");
 }
 
-std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
+Vec2 MainSceneSpawner::getPlayerSpawnPosition() const {
   const PlayerConfig &playerConfig = m_configManager.getPlayerConfig();
   const GameConfig   &gameConfig   = m_configManager.getGameConfig();
 
-  const Vec2 &windowSize     = gameConfig.windowSize;
-  const auto  playerHeight   = static_cast<float>(playerConfig.shape.height);
-  const auto  playerWidth    = static_cast<float>(playerConfig.shape.width);
-  const Vec2  centerPosition = windowSize / 2 - Vec2(playerWidth / 2, playerHeight / 2);
+  const Vec2 &windowSize   = gameConfig.windowSize;
+  const auto  playerHeight = static_cast<float>(playerConfig.shape.height);
+  const auto  playerWidth  = static_cast<float>(playerConfig.shape.width);
+  return windowSize / 2 - Vec2(playerWidth / 2, playerHeight / 2);
+}
 
-  const Vec2 &playerPosition = centerPosition;
-  const Vec2  playerVelocity = {0, 0};
+std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
+  const PlayerConfig &playerConfig = m_configManager.getPlayerConfig();
 
-  const auto cShape     = std::make_shared<CShape>(m_renderer, playerConfig.shape);
+  const Vec2 playerPosition = getPlayerSpawnPosition();
+  const Vec2 playerVelocity = {0, 0};
+
+  const auto cShape     = std::make_shared<CShape>(playerConfig.shape);
   const auto cTransform = std::make_shared<CTransform>(playerPosition, playerVelocity);
   const auto cInput     = std::make_shared<CInput>();
   const auto cEffects   = std::make_shared<CEffects>();
-  const auto cSprite =
-      std::make_shared<CSprite>(m_textureManager.getTexture(TextureName::EXAMPLE));
+  const auto cSprite    = std::make_shared<CSprite>(TextureName::EXAMPLE);
 
   std::shared_ptr<Entity> player = m_entityManager.addEntity(EntityTags::Player);
   player->setComponent(cTransform);
@@ -43,33 +47,44 @@ std::shared_ptr<Entity> MainSceneSpawner::spawnPlayer() {
   m_entityManager.update();
   return player;
 }
-void MainSceneSpawner::spawnEnemy(const std::shared_ptr<Entity> &player) {
+
+void MainSceneSpawner::resetPlayer(const std::shared_ptr<Entity> &player) const {
+  const auto &cTransform       = player->getComponent<CTransform>();
+  cTransform->topLeftCornerPos = getPlayerSpawnPosition();
+  cTransform->velocity         = {0, 0};
+
+  *player->getComponent<CInput>() = CInput();
+  player->getComponent<CEffects>()->clearEffects();
+}
+bool MainSceneSpawner::spawnEnemy(const std::shared_ptr<Entity> &player) {
   constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
   const GameConfig  &gameConfig  = m_configManager.getGameConfig();
   const EnemyConfig &enemyConfig = m_configManager.getEnemyConfig();
   const Vec2        &windowSize  = gameConfig.windowSize;
 
-  const Vec2 velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-  const Vec2 position = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+  const std::shared_ptr<Entity> &enemy = m_entityManager.addEntity(EntityTags::Enemy);
 
-  const auto cTransform = std::make_shared<CTransform>(position, velocity);
-  const auto cShape     = std::make_shared<CShape>(m_renderer, enemyConfig.shape);
-  const auto cLifespan  = std::make_shared<CLifespan>(enemyConfig.lifespan);
+  RandomStream placement = m_random.getStream(RandomStreamId::SPAWN_PLACEMENT, enemy->id());
 
-  const auto cSprite =
-      std::make_shared<CSprite>(m_textureManager.getTexture(TextureName::EXAMPLE));
+  const Vec2 velocity = SpawnHelpers::createValidVelocity(placement);
+  const Vec2 position = SpawnHelpers::createRandomPosition(placement, windowSize);
+
+  const auto cTransform = std::make_shared<CTransform>(position, velocity);
+  const auto cShape     = std::make_shared<CShape>(enemyConfig.shape);
+  const auto cLifespan  = std::make_shared<CLifespan>(enemyConfig.lifespan, m_currentTime);
+  const auto cSprite    = std::make_shared<CSprite>(TextureName::EXAMPLE);
 
-  const std::shared_ptr<Entity> &enemy = m_entityManager.addEntity(EntityTags::Enemy);
   enemy->setComponent<CTransform>(cTransform);
   enemy->setComponent<CShape>(cShape);
   enemy->setComponent<CLifespan>(cLifespan);
+  m_expiryTimers.scheduleLifespan(enemy);
   enemy->setComponent<CSprite>(cSprite);
   
   if (!player) {
-    SDL_Log("Player missing, destroying enemy");
+    LogHelpers::logInfo("Player missing, destroying enemy");
     enemy->destroy();
-    return;
+    return false;
   }
 
   bool isValidSpawn =
@@ -77,7 +92,7 @@ void MainSceneSpawner::spawnEnemy(const std::shared_ptr<Entity> &player) {
   int spawnAttempt = 1;
 
   while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-    const auto newPosition = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+    const auto newPosition = SpawnHelpers::createRandomPosition(placement, windowSize);
     enemy->getComponent<CTransform>()->topLeftCornerPos = newPosition;
     isValidSpawn =
         SpawnHelpers::validateSpawnPosition(enemy, player, m_entityManager, windowSize);
@@ -89,31 +104,38 @@ void MainSceneSpawner::spawnEnemy(const std::shared_ptr<Entity> &player) {
   }
 
   m_entityManager.update();
+  return isValidSpawn;
 }
-void MainSceneSpawner::spawnSpeedBoostEntity(const std::shared_ptr<Entity> &player) {
+bool MainSceneSpawner::spawnSpeedBoostEntity(const std::shared_ptr<Entity> &player) {
   constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
   const GameConfig        &gameConfig        = m_configManager.getGameConfig();
   const SpeedEffectConfig &speedEffectConfig = m_configManager.getSpeedEffectConfig();
   const Vec2              &windowSize        = gameConfig.windowSize;
 
-  const Vec2 velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-  const Vec2 position = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+  const auto &speedBoost = m_entityManager.addEntity(EntityTags::SpeedBoost);
+
+  RandomStream placement =
+      m_random.getStream(RandomStreamId::SPAWN_PLACEMENT, speedBoost->id());
+
+  const Vec2 velocity = SpawnHelpers::createValidVelocity(placement);
+  const Vec2 position = SpawnHelpers::createRandomPosition(placement, windowSize);
 
   const auto cTransform = std::make_shared<CTransform>(position, velocity);
-  const auto cShape     = std::make_shared<CShape>(m_renderer, speedEffectConfig.shape);
-  const auto cLifespan  = std::make_shared<CLifespan>(speedEffectConfig.lifespan);
+  const auto cShape     = std::make_shared<CShape>(speedEffectConfig.shape);
+  const auto cLifespan =
+      std::make_shared<CLifespan>(speedEffectConfig.lifespan, m_currentTime);
 
-  const auto &speedBoost = m_entityManager.addEntity(EntityTags::SpeedBoost);
   speedBoost->setComponent<CTransform>(cTransform);
   speedBoost->setComponent<CShape>(cShape);
   speedBoost->setComponent<CLifespan>(cLifespan);
+  m_expiryTimers.scheduleLifespan(speedBoost);
 
   // @todo Check for nullptr player
   if (!player) {
-    SDL_Log("Player missing, destroying speed boost");
+    LogHelpers::logInfo("Player missing, destroying speed boost");
     speedBoost->destroy();
-    return;
+    return false;
   }
 
   bool isValidSpawn =
@@ -121,7 +143,7 @@ void MainSceneSpawner::spawnSpeedBoostEntity(const std::shared_ptr<Entity> &play
   int spawnAttempt = 1;
 
   while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-    const auto newPosition = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+    const auto newPosition = SpawnHelpers::createRandomPosition(placement, windowSize);
     speedBoost->getComponent<CTransform>()->topLeftCornerPos = newPosition;
     isValidSpawn =
         SpawnHelpers::validateSpawnPosition(speedBoost, player, m_entityManager, windowSize);
@@ -133,8 +155,9 @@ void MainSceneSpawner::spawnSpeedBoostEntity(const std::shared_ptr<Entity> &play
   }
 
   m_entityManager.update();
+  return isValidSpawn;
 }
-void MainSceneSpawner::spawnSlownessEntity(const std::shared_ptr<Entity> &player) {
+bool MainSceneSpawner::spawnSlownessEntity(const std::shared_ptr<Entity> &player) {
   constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
   const auto &[windowSize, windowTitle, fontPath, spawnInterval] =
@@ -142,24 +165,29 @@ void MainSceneSpawner::spawnSlownessEntity(const std::shared_ptr<Entity> &player
 
   const SlownessEffectConfig &slownessEffectConfig = m_configManager.getSlownessEffectConfig();
 
-  const auto velocity = SpawnHelpers::createValidVelocity(m_randomGenerator);
-  const auto position = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
-
-  const auto cTransform = std::make_shared<CTransform>(position, velocity);
-  const auto cShape     = std::make_shared<CShape>(m_renderer, slownessEffectConfig.shape);
-  const auto cLifespan  = std::make_shared<CLifespan>(slownessEffectConfig.lifespan);
-
   const std::shared_ptr<Entity> &slownessEntity =
       m_entityManager.addEntity(EntityTags::SlownessDebuff);
 
+  RandomStream placement =
+      m_random.getStream(RandomStreamId::SPAWN_PLACEMENT, slownessEntity->id());
+
+  const auto velocity = SpawnHelpers::createValidVelocity(placement);
+  const auto position = SpawnHelpers::createRandomPosition(placement, windowSize);
+
+  const auto cTransform = std::make_shared<CTransform>(position, velocity);
+  const auto cShape     = std::make_shared<CShape>(slownessEffectConfig.shape);
+  const auto cLifespan =
+      std::make_shared<CLifespan>(slownessEffectConfig.lifespan, m_currentTime);
+
   slownessEntity->setComponent<CTransform>(cTransform);
   slownessEntity->setComponent<CShape>(cShape);
   slownessEntity->setComponent<CLifespan>(cLifespan);
+  m_expiryTimers.scheduleLifespan(slownessEntity);
 
   if (!player) {
-    SDL_Log("Player missing destroying slowness debuff");
+    LogHelpers::logInfo("Player missing destroying slowness debuff");
     slownessEntity->destroy();
-    return;
+    return false;
   }
 
   bool isValidSpawn = SpawnHelpers::validateSpawnPosition(
@@ -167,7 +195,7 @@ void MainSceneSpawner::spawnSlownessEntity(const std::shared_ptr<Entity> &player
   int spawnAttempt = 1;
 
   while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-    const auto newPosition = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+    const auto newPosition = SpawnHelpers::createRandomPosition(placement, windowSize);
     slownessEntity->getComponent<CTransform>()->topLeftCornerPos = newPosition;
     isValidSpawn = SpawnHelpers::validateSpawnPosition(
         slownessEntity, player, m_entityManager, windowSize);
@@ -179,12 +207,76 @@ void MainSceneSpawner::spawnSlownessEntity(const std::shared_ptr<Entity> &player
   }
 
   m_entityManager.update();
+  return isValidSpawn;
+}
+
+std::shared_ptr<Entity> MainSceneSpawner::spawnUnchecked(const EntityTags tag) {
+  ShapeConfig   shape;
+  std::uint64_t lifespan   = 0;
+  float         speed      = 1;
+  bool          moves      = true;
+  bool          hasSprite  = false;
+  bool          hasBounces = false;
+
+  switch (tag) {
+    case EntityTags::Enemy:
+      shape     = m_configManager.getEnemyConfig().shape;
+      lifespan  = m_configManager.getEnemyConfig().lifespan;
+      hasSprite = true;
+      break;
+    case EntityTags::Bullet:
+      shape      = m_configManager.getBulletConfig().shape;
+      lifespan   = m_configManager.getBulletConfig().lifespan;
+      speed      = m_configManager.getBulletConfig().speed;
+      hasBounces = true;
+      break;
+    case EntityTags::Item:
+      shape    = m_configManager.getItemConfig().shape;
+      lifespan = m_configManager.getItemConfig().lifespan;
+      moves    = false;
+      break;
+    case EntityTags::SpeedBoost:
+      shape    = m_configManager.getSpeedEffectConfig().shape;
+      lifespan = m_configManager.getSpeedEffectConfig().lifespan;
+      break;
+    case EntityTags::SlownessDebuff:
+      shape    = m_configManager.getSlownessEffectConfig().shape;
+      lifespan = m_configManager.getSlownessEffectConfig().lifespan;
+      break;
+    default:
+      return nullptr;
+  }
+
+  const Vec2 &windowSize = m_configManager.getGameConfig().windowSize;
+  const Vec2  placementArea(windowSize.x - shape.width, windowSize.y - shape.height);
+
+  const std::shared_ptr<Entity> entity = m_entityManager.addEntity(tag);
+
+  RandomStream placement = m_random.getStream(RandomStreamId::SPAWN_PLACEMENT, entity->id());
+
+  const Vec2 velocity =
+      moves ? SpawnHelpers::createValidVelocity(placement) * speed : Vec2(0, 0);
+  const Vec2 position = SpawnHelpers::createRandomPosition(placement, placementArea);
+
+  entity->setComponent<CTransform>(std::make_shared<CTransform>(position, velocity));
+  entity->setComponent<CShape>(std::make_shared<CShape>(shape));
+  entity->setComponent<CLifespan>(std::make_shared<CLifespan>(lifespan, m_currentTime));
+  m_expiryTimers.scheduleLifespan(entity);
+
+  if (hasSprite) {
+    entity->setComponent<CSprite>(std::make_shared<CSprite>(TextureName::EXAMPLE));
+  }
+  if (hasBounces) {
+    entity->setComponent<CBounceTracker>(std::make_shared<CBounceTracker>());
+  }
+
+  return entity;
 }
 
 void MainSceneSpawner::spawnWalls() {
   const GameConfig &gameConfig = m_configManager.getGameConfig();
 
-  constexpr SDL_Color wallColor  = {.r = 176, .g = 196, .b = 222, .a = 255};
+  constexpr Color     wallColor  = {.r = 176, .g = 196, .b = 222, .a = 255};
   const float         wallHeight = gameConfig.windowSize.y * 0.6f;
   const float         wallWidth  = gameConfig.windowSize.x * 0.025f;
 
@@ -207,7 +299,7 @@ void MainSceneSpawner::spawnWalls() {
   const float outerGapSize = outerWidth * 0.18f;
 
   for (int i = 0; i < WALL_COUNT; i++) {
-    const auto shapeComponent     = std::make_shared<CShape>(m_renderer, wallConfig);
+    const auto shapeComponent     = std::make_shared<CShape>(wallConfig);
     const auto transformComponent = std::make_shared<CTransform>();
 
     Vec2 &topLeftCornerPos = transformComponent->topLeftCornerPos;
@@ -263,7 +355,7 @@ void MainSceneSpawner::spawnBullets(const std::shared_ptr<Entity> &player,
   const auto &[lifespan, speed, shape] = m_configManager.getBulletConfig();
 
   if (!player) {
-    SDL_Log("player missing, not creating bullet");
+    LogHelpers::logInfo("player missing, not creating bullet");
     return;
   }
   const Vec2 &playerCenter = player->getCenterPos();
@@ -290,14 +382,15 @@ void MainSceneSpawner::spawnBullets(const std::shared_ptr<Entity> &player,
   bulletPos.y = playerCenter.y + direction.y * spawnOffset - bulletHalfHeight;
 
   const auto cTransform     = std::make_shared<CTransform>(bulletPos, bulletVelocity);
-  const auto cLifespan      = std::make_shared<CLifespan>(lifespan);
+  const auto cLifespan      = std::make_shared<CLifespan>(lifespan, m_currentTime);
   const auto cBounceTracker = std::make_shared<CBounceTracker>();
-  const auto cShape         = std::make_shared<CShape>(
-      m_renderer, ShapeConfig(shape.height, shape.width, shape.color));
+  const auto cShape =
+      std::make_shared<CShape>(ShapeConfig(shape.height, shape.width, shape.color));
 
   bullet->setComponent<CShape>(cShape);
   bullet->setComponent<CTransform>(cTransform);
   bullet->setComponent<CLifespan>(cLifespan);
+  m_expiryTimers.scheduleLifespan(bullet);
   bullet->setComponent<CBounceTracker>(cBounceTracker);
 
   for (const std::shared_ptr<Entity> &wall : walls) {
@@ -310,28 +403,32 @@ void MainSceneSpawner::spawnBullets(const std::shared_ptr<Entity> &player,
   m_entityManager.update();
 }
 
-void MainSceneSpawner::spawnItem(const std::shared_ptr<Entity> &player) {
+bool MainSceneSpawner::spawnItem(const std::shared_ptr<Entity> &player) {
   constexpr int MAX_SPAWN_ATTEMPTS = 10;
 
   const GameConfig &gameConfig                          = m_configManager.getGameConfig();
   const auto &[spawnPercentage, lifespan, speed, shape] = m_configManager.getItemConfig();
   const Vec2 &windowSize                                = gameConfig.windowSize;
 
-  const auto position   = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+  const auto &item = m_entityManager.addEntity(EntityTags::Item);
+
+  RandomStream placement = m_random.getStream(RandomStreamId::SPAWN_PLACEMENT, item->id());
+
+  const auto position   = SpawnHelpers::createRandomPosition(placement, windowSize);
   const auto velocity   = Vec2(0, 0);
   const auto cTransform = std::make_shared<CTransform>(position, velocity);
-  const auto cShape     = std::make_shared<CShape>(m_renderer, shape);
-  const auto cLifespan  = std::make_shared<CLifespan>(lifespan);
+  const auto cShape     = std::make_shared<CShape>(shape);
+  const auto cLifespan  = std::make_shared<CLifespan>(lifespan, m_currentTime);
 
-  const auto &item = m_entityManager.addEntity(EntityTags::Item);
   item->setComponent<CTransform>(cTransform);
   item->setComponent<CShape>(cShape);
   item->setComponent<CLifespan>(cLifespan);
+  m_expiryTimers.scheduleLifespan(item);
 
   if (!player) {
-    SDL_Log("Player missing, destroying item entity");
+    LogHelpers::logInfo("Player missing, destroying item entity");
     item->destroy();
-    return;
+    return false;
   }
 
   bool isValidSpawn =
@@ -339,7 +436,7 @@ void MainSceneSpawner::spawnItem(const std::shared_ptr<Entity> &player) {
   int spawnAttempt = 1;
 
   while (!isValidSpawn && spawnAttempt < MAX_SPAWN_ATTEMPTS) {
-    const auto newPosition = SpawnHelpers::createRandomPosition(m_randomGenerator, windowSize);
+    const auto newPosition = SpawnHelpers::createRandomPosition(placement, windowSize);
     item->getComponent<CTransform>()->topLeftCornerPos = newPosition;
 
     isValidSpawn =
@@ -352,4 +449,5 @@ void MainSceneSpawner::spawnItem(const std::shared_ptr<Entity> &player) {
   }
 
   m_entityManager.update();
-}
\ No newline at end of file
+  return isValidSpawn;
+}
@@ -0,0 +1,156 @@
+#include "../../includes/Simulation/MultiEnvironmentRunner.hpp"
+#include "../../includes/EntityManagement/Entity.hpp"
+
+#include <algorithm>
+
+MultiEnvironmentRunner::MultiEnvironmentRunner(ConfigManager      &configManager,
+                                               const size_t        environmentCount,
+                                               const std::uint32_t seed,
+                                               const size_t        threadCount,
+                                               const std::uint64_t stepDuration) :
+    m_configManager(configManager),
+    m_environments(environmentCount),
+    m_observations(environmentCount * OBSERVATION_SIZE, 0.0f),
+    m_rewards(environmentCount, 0.0f),
+    m_dones(environmentCount, 0),
+    m_lastScores(environmentCount, 0),
+    m_episodeCounts(environmentCount, 0),
+    m_seed(seed),
+    m_stepDuration(stepDuration),
+    m_jobSystem(std::clamp<size_t>(threadCount, 1, std::max<size_t>(1, environmentCount))),
+    m_stepLoop(m_jobSystem, [this](const size_t begin, const size_t end) -> void {
+      stepRange(begin, end);
+    }) {
+  reset();
+}
+
+std::uint32_t MultiEnvironmentRunner::createSeed(const size_t index) const {
+  // SplitMix64 over (seed, environment, episode) so neighbouring environments get unrelated
+  // streams.
+  std::uint64_t value = m_seed;
+  value ^= static_cast<std::uint64_t>(index) * 0x9E3779B97F4A7C15ULL;
+  value ^= m_episodeCounts[index] * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  value = value ^ (value >> 31);
+  return static_cast<std::uint32_t>(value);
+}
+
+void MultiEnvironmentRunner::resetEnvironment(const size_t index) {
+  // Environments are only created once; later episodes reuse them without allocating.
+  if (m_environments[index] == nullptr) {
+    m_environments[index] =
+        std::make_unique<MainSceneSimulation>(m_configManager, createSeed(index));
+  } else {
+    m_environments[index]->reset(createSeed(index));
+  }
+  m_episodeCounts[index] += 1;
+  m_lastScores[index] = 0;
+}
+
+void MultiEnvironmentRunner::reset() {
+  for (size_t index = 0; index < m_environments.size(); index++) {
+    resetEnvironment(index);
+    m_rewards[index] = 0.0f;
+    m_dones[index]   = 0;
+    writeObservation(index);
+  }
+}
+
+void MultiEnvironmentRunner::writeObservation(const size_t index) {
+  MainSceneSimulation &simulation  = *m_environments[index];
+  EntityManager       &entities    = simulation.getEntityManager();
+  float               *observation = m_observations.data() + index * OBSERVATION_SIZE;
+
+  const std::shared_ptr<Entity> &player     = simulation.getPlayer();
+  const auto                    &cTransform = player->getComponent<CTransform>();
+  const auto                    &cEffects   = player->getComponent<CEffects>();
+
+  observation[PLAYER_X]               = cTransform->topLeftCornerPos.x;
+  observation[PLAYER_Y]               = cTransform->topLeftCornerPos.y;
+  observation[PLAYER_VELOCITY_X]      = cTransform->velocity.x;
+  observation[PLAYER_VELOCITY_Y]      = cTransform->velocity.y;
+  observation[SCORE]                  = static_cast<float>(simulation.getScore());
+  observation[LIVES]                  = static_cast<float>(simulation.getLives());
+  observation[TIME_REMAINING]         = static_cast<float>(simulation.getTimeRemaining());
+  observation[SPEED_EFFECT_ACTIVE]    = cEffects->hasEffect(Speed) ? 1.0f : 0.0f;
+  observation[SLOWNESS_EFFECT_ACTIVE] = cEffects->hasEffect(Slowness) ? 1.0f : 0.0f;
+  observation[ENEMY_COUNT] =
+      static_cast<float>(entities.getEntities(EntityTags::Enemy).size());
+  observation[BULLET_COUNT] =
+      static_cast<float>(entities.getEntities(EntityTags::Bullet).size());
+  observation[ITEM_COUNT] =
+      static_cast<float>(entities.getEntities(EntityTags::Item).size());
+  observation[SPEED_BOOST_COUNT] =
+      static_cast<float>(entities.getEntities(EntityTags::SpeedBoost).size());
+  observation[SLOWNESS_DEBUFF_COUNT] =
+      static_cast<float>(entities.getEntities(EntityTags::SlownessDebuff).size());
+}
+
+void MultiEnvironmentRunner::stepRange(const size_t begin, const size_t end) {
+  for (size_t index = begin; index < end; index++) {
+    if (m_dones[index] != 0) {
+      resetEnvironment(index);
+    }
+
+    MainSceneSimulation &simulation = *m_environments[index];
+
+    if (m_actions != nullptr) {
+      const EnvironmentAction &action = m_actions[index];
+
+      auto movementState = [](const bool active) -> ActionState {
+        return active ? ActionState::START : ActionState::END;
+      };
+
+      simulation.sDoAction(Action("FORWARD", movementState(action.forward), std::nullopt));
+      simulation.sDoAction(Action("BACKWARD", movementState(action.backward), std::nullopt));
+      simulation.sDoAction(Action("LEFT", movementState(action.left), std::nullopt));
+      simulation.sDoAction(Action("RIGHT", movementState(action.right), std::nullopt));
+
+      if (action.shoot) {
+        simulation.sDoAction(Action("SHOOT", ActionState::START, action.target));
+      }
+    }
+
+    simulation.update(m_stepDuration);
+    simulation.clearEvents();
+
+    const int score     = simulation.getScore();
+    m_rewards[index]    = static_cast<float>(score - m_lastScores[index]);
+    m_lastScores[index] = score;
+    m_dones[index]      = simulation.isGameOver() ? 1 : 0;
+
+    writeObservation(index);
+  }
+}
+
+void MultiEnvironmentRunner::step(const EnvironmentAction *actions) {
+  // One environment per item, so threads that finish early take environments still to step.
+  m_actions = actions;
+  m_stepLoop.run(0, m_environments.size(), 1);
+  m_actions = nullptr;
+}
+
+size_t MultiEnvironmentRunner::getEnvironmentCount() const {
+  return m_environments.size();
+}
+
+size_t MultiEnvironmentRunner::getThreadCount() const {
+  return m_jobSystem.getThreadCount();
+}
+
+const float *MultiEnvironmentRunner::getObservations() const {
+  return m_observations.data();
+}
+
+const float *MultiEnvironmentRunner::getRewards() const {
+  return m_rewards.data();
+}
+
+const std::uint8_t *MultiEnvironmentRunner::getDones() const {
+  return m_dones.data();
+}
+
+MainSceneSimulation &MultiEnvironmentRunner::getEnvironment(const size_t index) {
+  return *m_environments[index];
+}
@@ -0,0 +1,229 @@
+#include "../../includes/Simulation/RewindBuffer.hpp"
+
+#include <algorithm>
+
+namespace {
+  void appendVarint(std::vector<std::uint8_t> &output, std::uint64_t value) {
+    while (value >= 0x80) {
+      output.push_back(static_cast<std::uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    output.push_back(static_cast<std::uint8_t>(value));
+  }
+} // namespace
+
+std::uint64_t RewindBuffer::Segment::getLastTick() const {
+  return firstTick + deltaOffsets.size();
+}
+
+size_t RewindBuffer::Segment::getMemoryUsage() const {
+  return keyframe.size() + deltas.size() + deltaOffsets.size() * sizeof(size_t);
+}
+
+RewindBuffer::RewindBuffer(const size_t memoryBudget, const std::uint64_t keyframeInterval) :
+    m_memoryBudget(memoryBudget),
+    m_keyframeInterval(std::max<std::uint64_t>(1, keyframeInterval)) {}
+
+void RewindBuffer::encodeDelta(const std::vector<std::uint8_t> &previous,
+                               const std::vector<std::uint8_t> &current,
+                               std::vector<std::uint8_t>       &output) {
+  // Bytes past the end of the previous snapshot are treated as zero.
+  auto previousByte = [&previous](const size_t index) -> std::uint8_t {
+    return index < previous.size() ? previous[index] : 0;
+  };
+  auto changed = [&](const size_t index) -> bool {
+    return index < current.size() && previousByte(index) != current[index];
+  };
+
+  // Short unchanged gaps are folded into the changed run, since each run costs two varints.
+  constexpr size_t MIN_UNCHANGED_RUN = 3;
+
+  appendVarint(output, current.size());
+
+  size_t index = 0;
+  while (index < current.size()) {
+    const size_t unchangedStart = index;
+    while (index < current.size() && !changed(index)) {
+      index++;
+    }
+
+    const size_t changedStart = index;
+    while (index < current.size()) {
+      if (changed(index)) {
+        index++;
+        continue;
+      }
+
+      size_t gap = 0;
+      while (gap < MIN_UNCHANGED_RUN && index + gap < current.size() &&
+             !changed(index + gap)) {
+        gap++;
+      }
+      if (gap == MIN_UNCHANGED_RUN || index + gap == current.size()) {
+        break;
+      }
+      index += gap;
+    }
+
+    appendVarint(output, changedStart - unchangedStart);
+    appendVarint(output, index - changedStart);
+    for (size_t i = changedStart; i < index; i++) {
+      output.push_back(current[i] ^ previousByte(i));
+    }
+  }
+}
+
+void RewindBuffer::decodeDelta(const std::uint8_t        *delta,
+                               const size_t               size,
+                               std::vector<std::uint8_t> &snapshot) {
+  BinaryReader reader(delta, size);
+
+  const auto snapshotSize = static_cast<size_t>(reader.readVarint());
+  snapshot.resize(snapshotSize, 0);
+
+  size_t index = 0;
+  while (!reader.isAtEnd()) {
+    index += static_cast<size_t>(reader.readVarint());
+    const auto changedCount = static_cast<size_t>(reader.readVarint());
+    if (index + changedCount > snapshotSize) {
+      throw BinaryFormatError("Rewind delta runs past the end of the snapshot");
+    }
+
+    for (size_t i = 0; i < changedCount; i++) {
+      snapshot[index + i] ^= reader.readU8();
+    }
+    index += changedCount;
+  }
+}
+
+void RewindBuffer::record(const MainSceneSimulation &simulation) {
+  const std::uint64_t tick = simulation.getTick();
+
+  if (m_previousTick.has_value() && tick <= *m_previousTick) {
+    discardAfter(tick == 0 ? 0 : tick - 1);
+    if (tick == 0) {
+      clear();
+    }
+  }
+
+  m_writer.clear();
+  simulation.saveSnapshot(m_writer);
+  const std::vector<std::uint8_t> &snapshot = m_writer.getBuffer();
+
+  const bool continuesLastSegment = m_previousTick.has_value() && !m_segments.empty() &&
+                                    m_segments.back().getLastTick() == *m_previousTick &&
+                                    *m_previousTick + 1 == tick;
+
+  if (!continuesLastSegment || tick - m_segments.back().firstTick >= m_keyframeInterval) {
+    Segment &segment  = m_segments.emplace_back();
+    segment.firstTick = tick;
+    segment.keyframe  = snapshot;
+    m_memoryUsage += segment.getMemoryUsage();
+  } else {
+    Segment     &segment     = m_segments.back();
+    const size_t usageBefore = segment.getMemoryUsage();
+
+    segment.deltaOffsets.push_back(segment.deltas.size());
+    encodeDelta(m_previousSnapshot, snapshot, segment.deltas);
+
+    m_memoryUsage += segment.getMemoryUsage() - usageBefore;
+  }
+
+  m_previousSnapshot.assign(snapshot.begin(), snapshot.end());
+  m_previousTick = tick;
+
+  enforceMemoryBudget();
+}
+
+bool RewindBuffer::seek(MainSceneSimulation &simulation, const std::uint64_t tick) {
+  const auto segment = std::ranges::find_if(m_segments, [tick](const Segment &candidate) {
+    return candidate.firstTick <= tick && tick <= candidate.getLastTick();
+  });
+  if (segment == m_segments.end()) {
+    return false;
+  }
+
+  std::vector<std::uint8_t> snapshot = segment->keyframe;
+  const size_t              count    = tick - segment->firstTick;
+  for (size_t i = 0; i < count; i++) {
+    const size_t begin = segment->deltaOffsets[i];
+    const size_t end   = i + 1 < segment->deltaOffsets.size() ? segment->deltaOffsets[i + 1]
+                                                              : segment->deltas.size();
+    decodeDelta(segment->deltas.data() + begin, end - begin, snapshot);
+  }
+
+  BinaryReader reader(snapshot);
+  simulation.restoreSnapshot(reader);
+
+  // Playing on from here branches the timeline, so the newer ticks are no longer reachable.
+  discardAfter(tick);
+  m_previousSnapshot = std::move(snapshot);
+  m_previousTick     = tick;
+
+  return true;
+}
+
+bool RewindBuffer::stepBack(MainSceneSimulation &simulation, const std::uint64_t ticks) {
+  const std::optional<std::uint64_t> oldestTick = getOldestTick();
+  const std::uint64_t                currentTick = simulation.getTick();
+  if (!oldestTick.has_value() || currentTick <= *oldestTick) {
+    return false;
+  }
+
+  const std::uint64_t targetTick = currentTick > ticks ? currentTick - ticks : 0;
+  return seek(simulation, std::max(targetTick, *oldestTick));
+}
+
+void RewindBuffer::discardAfter(const std::uint64_t tick) {
+  while (!m_segments.empty() && m_segments.back().firstTick > tick) {
+    m_memoryUsage -= m_segments.back().getMemoryUsage();
+    m_segments.pop_back();
+  }
+
+  if (!m_segments.empty() && m_segments.back().getLastTick() > tick) {
+    Segment     &segment     = m_segments.back();
+    const size_t usageBefore = segment.getMemoryUsage();
+    const size_t keptDeltas  = tick - segment.firstTick;
+
+    segment.deltas.resize(segment.deltaOffsets[keptDeltas]);
+    segment.deltaOffsets.resize(keptDeltas);
+
+    m_memoryUsage -= usageBefore - segment.getMemoryUsage();
+  }
+
+  if (m_previousTick.has_value() && *m_previousTick > tick) {
+    m_previousTick.reset();
+  }
+}
+
+void RewindBuffer::enforceMemoryBudget() {
+  while (m_memoryUsage > m_memoryBudget && m_segments.size() > 1) {
+    m_memoryUsage -= m_segments.front().getMemoryUsage();
+    m_segments.pop_front();
+  }
+}
+
+std::optional<std::uint64_t> RewindBuffer::getOldestTick() const {
+  if (m_segments.empty()) {
+    return std::nullopt;
+  }
+  return m_segments.front().firstTick;
+}
+
+std::optional<std::uint64_t> RewindBuffer::getNewestTick() const {
+  if (m_segments.empty()) {
+    return std::nullopt;
+  }
+  return m_segments.back().getLastTick();
+}
+
+size_t RewindBuffer::getMemoryUsage() const {
+  return m_memoryUsage;
+}
+
+void RewindBuffer::clear() {
+  m_segments.clear();
+  m_memoryUsage = 0;
+  m_previousSnapshot.clear();
+  m_previousTick.reset();
+}
@@ -0,0 +1,19 @@
+#include "../../includes/Simulation/SimulationRandom.hpp"
+
+SimulationRandom::SimulationRandom(const std::uint32_t seed, const std::uint64_t &tick) :
+    m_seed(seed),
+    m_tick(tick) {}
+
+RandomStream SimulationRandom::getStream(const RandomStreamId streamId,
+                                         const std::uint64_t  subject) const {
+  const std::uint64_t key = static_cast<std::uint64_t>(streamId) << 32 | m_seed;
+  return {key, m_tick, static_cast<std::uint32_t>(subject)};
+}
+
+std::uint32_t SimulationRandom::getSeed() const {
+  return m_seed;
+}
+
+void SimulationRandom::setSeed(const std::uint32_t seed) {
+  m_seed = seed;
+}
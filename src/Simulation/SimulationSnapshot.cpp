@@ -0,0 +1,202 @@
+#include "../../includes/Simulation/SimulationSnapshot.hpp"
+
+namespace SimulationSnapshot {
+  namespace {
+    enum ComponentFlag : std::uint8_t {
+      HAS_TRANSFORM      = 1 << 0,
+      HAS_SHAPE          = 1 << 1,
+      HAS_INPUT          = 1 << 2,
+      HAS_LIFESPAN       = 1 << 3,
+      HAS_EFFECTS        = 1 << 4,
+      HAS_BOUNCE_TRACKER = 1 << 5,
+      HAS_SPRITE         = 1 << 6,
+    };
+
+    constexpr std::uint8_t ENTITY_ACTIVE  = 1 << 0;
+    constexpr std::uint8_t ENTITY_PENDING = 1 << 1;
+
+    std::uint8_t componentFlags(const Entity &entity) {
+      std::uint8_t flags = 0;
+      flags |= entity.hasComponent<CTransform>() ? HAS_TRANSFORM : 0;
+      flags |= entity.hasComponent<CShape>() ? HAS_SHAPE : 0;
+      flags |= entity.hasComponent<CInput>() ? HAS_INPUT : 0;
+      flags |= entity.hasComponent<CLifespan>() ? HAS_LIFESPAN : 0;
+      flags |= entity.hasComponent<CEffects>() ? HAS_EFFECTS : 0;
+      flags |= entity.hasComponent<CBounceTracker>() ? HAS_BOUNCE_TRACKER : 0;
+      flags |= entity.hasComponent<CSprite>() ? HAS_SPRITE : 0;
+      return flags;
+    }
+
+    void writeEntity(BinaryWriter &writer, const Entity &entity, const bool pending) {
+      std::uint8_t state = 0;
+      state |= entity.isActive() ? ENTITY_ACTIVE : 0;
+      state |= pending ? ENTITY_PENDING : 0;
+
+      const std::uint8_t flags = componentFlags(entity);
+
+      writer.writeVarint(entity.id());
+      writer.writeU8(static_cast<std::uint8_t>(entity.tag()));
+      writer.writeU8(state);
+      writer.writeU8(flags);
+
+      if ((flags & HAS_TRANSFORM) != 0) {
+        const auto cTransform = entity.getComponent<CTransform>();
+        writer.writeVec2(cTransform->topLeftCornerPos);
+        writer.writeVec2(cTransform->velocity);
+      }
+
+      if ((flags & HAS_SHAPE) != 0) {
+        const auto cShape = entity.getComponent<CShape>();
+        writer.writeSignedVarint(cShape->rect.w);
+        writer.writeSignedVarint(cShape->rect.h);
+        writer.writeBytes(&cShape->color, sizeof(Color));
+      }
+
+      if ((flags & HAS_INPUT) != 0) {
+        const auto   cInput = entity.getComponent<CInput>();
+        std::uint8_t input  = 0;
+        input |= cInput->forward ? 1 << 0 : 0;
+        input |= cInput->backward ? 1 << 1 : 0;
+        input |= cInput->left ? 1 << 2 : 0;
+        input |= cInput->right ? 1 << 3 : 0;
+        writer.writeU8(input);
+      }
+
+      if ((flags & HAS_LIFESPAN) != 0) {
+        const auto cLifespan = entity.getComponent<CLifespan>();
+        writer.writeVarint(cLifespan->birthTime);
+        writer.writeVarint(cLifespan->lifespan);
+      }
+
+      if ((flags & HAS_EFFECTS) != 0) {
+        const std::vector<Effect> &effects = entity.getComponent<CEffects>()->getEffects();
+        writer.writeVarint(effects.size());
+        for (const auto &[startTime, duration, type] : effects) {
+          writer.writeVarint(startTime);
+          writer.writeVarint(duration);
+          writer.writeU8(static_cast<std::uint8_t>(type));
+        }
+      }
+
+      if ((flags & HAS_BOUNCE_TRACKER) != 0) {
+        writer.writeSignedVarint(entity.getComponent<CBounceTracker>()->getBounces());
+      }
+
+      if ((flags & HAS_SPRITE) != 0) {
+        const auto textureName = entity.getComponent<CSprite>()->getTextureName();
+        writer.writeU8(static_cast<std::uint8_t>(textureName));
+      }
+    }
+
+    void readEntity(BinaryReader &reader, EntityManager &entityManager) {
+      const auto         id    = static_cast<size_t>(reader.readVarint());
+      const std::uint8_t tag   = reader.readU8();
+      const std::uint8_t state = reader.readU8();
+      const std::uint8_t flags = reader.readU8();
+
+      if (tag > EntityTags::Default) {
+        throw BinaryFormatError("Snapshot contains an unknown entity tag");
+      }
+
+      const std::shared_ptr<Entity> entity = entityManager.restoreEntity(
+          id, static_cast<EntityTags>(tag), (state & ENTITY_PENDING) != 0);
+
+      if ((state & ENTITY_ACTIVE) == 0) {
+        entity->destroy();
+      }
+
+      if ((flags & HAS_TRANSFORM) != 0) {
+        const Vec2 position = reader.readVec2();
+        const Vec2 velocity = reader.readVec2();
+        entity->setComponent(std::make_shared<CTransform>(position, velocity));
+      }
+
+      if ((flags & HAS_SHAPE) != 0) {
+        const auto cShape = std::make_shared<CShape>(ShapeConfig());
+        cShape->rect.w    = static_cast<int>(reader.readSignedVarint());
+        cShape->rect.h    = static_cast<int>(reader.readSignedVarint());
+        reader.readBytes(&cShape->color, sizeof(Color));
+        entity->setComponent(cShape);
+      }
+
+      if ((flags & HAS_INPUT) != 0) {
+        const std::uint8_t input  = reader.readU8();
+        const auto         cInput = std::make_shared<CInput>();
+        cInput->forward           = (input & 1 << 0) != 0;
+        cInput->backward          = (input & 1 << 1) != 0;
+        cInput->left              = (input & 1 << 2) != 0;
+        cInput->right             = (input & 1 << 3) != 0;
+        entity->setComponent(cInput);
+      }
+
+      if ((flags & HAS_LIFESPAN) != 0) {
+        const std::uint64_t birthTime = reader.readVarint();
+        const std::uint64_t lifespan  = reader.readVarint();
+        entity->setComponent(std::make_shared<CLifespan>(lifespan, birthTime));
+      }
+
+      if ((flags & HAS_EFFECTS) != 0) {
+        const auto          cEffects    = std::make_shared<CEffects>();
+        const std::uint64_t effectCount = reader.readVarint();
+        for (std::uint64_t i = 0; i < effectCount; i++) {
+          const std::uint64_t startTime = reader.readVarint();
+          const std::uint64_t duration  = reader.readVarint();
+          const auto          type      = static_cast<EffectTypes>(reader.readU8());
+          cEffects->addEffect({.startTime = startTime, .duration = duration, .type = type});
+        }
+        entity->setComponent(cEffects);
+      }
+
+      if ((flags & HAS_BOUNCE_TRACKER) != 0) {
+        const auto bounces = static_cast<int>(reader.readSignedVarint());
+        entity->setComponent(std::make_shared<CBounceTracker>(bounces));
+      }
+
+      if ((flags & HAS_SPRITE) != 0) {
+        const auto textureName = static_cast<TextureName>(reader.readU8());
+        entity->setComponent(std::make_shared<CSprite>(textureName));
+      }
+    }
+  } // namespace
+
+  void writeHeader(BinaryWriter &writer) {
+    writer.writeU32(MAGIC);
+    writer.writeU16(VERSION);
+  }
+
+  void readHeader(BinaryReader &reader) {
+    if (reader.readU32() != MAGIC) {
+      throw BinaryFormatError("Not a simulation snapshot");
+    }
+
+    const std::uint16_t version = reader.readU16();
+    if (version != VERSION) {
+      throw BinaryFormatError("Unsupported snapshot version " + std::to_string(version));
+    }
+  }
+
+  void writeEntities(BinaryWriter &writer, const EntityManager &entityManager) {
+    const EntityVector &entities = entityManager.getEntities();
+    const EntityVector &pending  = entityManager.getPendingEntities();
+
+    writer.writeVarint(entityManager.getTotalEntities());
+    writer.writeVarint(entities.size() + pending.size());
+
+    for (const std::shared_ptr<Entity> &entity : entities) {
+      writeEntity(writer, *entity, false);
+    }
+    for (const std::shared_ptr<Entity> &entity : pending) {
+      writeEntity(writer, *entity, true);
+    }
+  }
+
+  void readEntities(BinaryReader &reader, EntityManager &entityManager) {
+    const auto          totalEntities = static_cast<size_t>(reader.readVarint());
+    const std::uint64_t entityCount   = reader.readVarint();
+
+    entityManager.clear(totalEntities);
+    for (std::uint64_t i = 0; i < entityCount; i++) {
+      readEntity(reader, entityManager);
+    }
+  }
+} // namespace SimulationSnapshot
@@ -0,0 +1,79 @@
+#include "../../includes/Simulation/SpawnBudgetController.hpp"
+
+#include <algorithm>
+
+namespace {
+  // Weight of the newest frame in the smoothed frame cost.
+  constexpr float SMOOTHING = 0.1f;
+
+  // Frames between adjustments, so each change shows up in the smoothed cost before the next.
+  constexpr std::uint64_t ADJUSTMENT_INTERVAL = 15;
+
+  constexpr std::uint8_t PERCENTAGE_STEP = 25;
+
+  // The budget is raised again only well under the target, so it does not oscillate.
+  constexpr float RECOVERY_LOAD = 0.75f;
+
+  // Culling starts once deferring every spawn round has not brought the load back down.
+  constexpr float CULL_LOAD = 1.25f;
+} // namespace
+
+SpawnBudgetController::SpawnBudgetController(const SpawnBudgetConfig &config) :
+    m_config(config) {}
+
+std::optional<MainSceneSimulation::SpawnBudget>
+SpawnBudgetController::update(const float frameCost, EntityManager &entityManager) {
+  if (!m_config.enabled) {
+    return std::nullopt;
+  }
+
+  if (m_frameCount == 0) {
+    m_metrics.frameCost = frameCost;
+  } else {
+    m_metrics.frameCost += (frameCost - m_metrics.frameCost) * SMOOTHING;
+  }
+  m_frameCount += 1;
+
+  if (isSheddingLoad()) {
+    m_metrics.throttledFrames += 1;
+  }
+
+  if (m_frameCount % ADJUSTMENT_INTERVAL != 0) {
+    return std::nullopt;
+  }
+
+  const float   load       = m_metrics.frameCost / m_config.frameTimeTarget;
+  std::uint8_t &percentage = m_metrics.spawnPercentage;
+
+  MainSceneSimulation::SpawnBudget spawnBudget;
+
+  if (m_config.cullingEnabled && percentage == 0 && load > CULL_LOAD) {
+    const size_t cullCount =
+        std::min<size_t>(m_config.maxCullPerAdjustment, countCullable(entityManager));
+    spawnBudget.cullCount = static_cast<std::uint8_t>(cullCount);
+    m_metrics.culledEntities += cullCount;
+  }
+
+  if (load > 1) {
+    percentage = percentage > PERCENTAGE_STEP ? percentage - PERCENTAGE_STEP : 0;
+  } else if (load < RECOVERY_LOAD) {
+    percentage = std::min<std::uint8_t>(percentage + PERCENTAGE_STEP, 100);
+  }
+
+  spawnBudget.spawnPercentage = percentage;
+  return spawnBudget;
+}
+
+size_t SpawnBudgetController::countCullable(EntityManager &entityManager) {
+  return entityManager.getEntities(EntityTags::Enemy).size() +
+         entityManager.getEntities(EntityTags::SpeedBoost).size() +
+         entityManager.getEntities(EntityTags::SlownessDebuff).size();
+}
+
+bool SpawnBudgetController::isSheddingLoad() const {
+  return m_metrics.spawnPercentage < 100;
+}
+
+const SpawnBudgetController::Metrics &SpawnBudgetController::getMetrics() const {
+  return m_metrics;
+}
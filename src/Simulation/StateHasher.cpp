@@ -0,0 +1,258 @@
+#include "../../includes/Simulation/StateHasher.hpp"
+#include "../../includes/Helpers/BinaryIO.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <set>
+
+namespace {
+  constexpr std::uint32_t HASH_LOG_MAGIC   = 0x48425259; // "YRBH"
+  constexpr std::uint16_t HASH_LOG_VERSION = 1;
+
+  std::uint64_t mix(std::uint64_t value) {
+    // SplitMix64 finalizer.
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return value;
+  }
+
+  std::uint64_t combine(const std::uint64_t hash, const std::uint64_t value) {
+    return mix(hash + 0x9E3779B97F4A7C15ULL + mix(value));
+  }
+
+  std::uint64_t combine(const std::uint64_t hash, const float value) {
+    return combine(hash, static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(value)));
+  }
+
+  struct HashLogTick {
+    std::uint64_t                              tick       = 0;
+    std::uint64_t                              stateHash  = 0;
+    std::uint64_t                              globalHash = 0;
+    std::vector<StateHasher::EntityHashChange> changes;
+  };
+
+  std::vector<HashLogTick> readHashLog(const std::filesystem::path &path) {
+    const std::vector<std::uint8_t> bytes = BinaryHelpers::readFile(path);
+    BinaryReader                    reader(bytes);
+
+    if (reader.readU32() != HASH_LOG_MAGIC) {
+      throw BinaryFormatError(path.string() + " is not a state hash log");
+    }
+    if (reader.readU16() != HASH_LOG_VERSION) {
+      throw BinaryFormatError(path.string() + " uses an unsupported state hash log version");
+    }
+
+    std::vector<HashLogTick> ticks;
+    while (!reader.isAtEnd()) {
+      HashLogTick record;
+      record.tick       = reader.readVarint();
+      record.stateHash  = reader.readU64();
+      record.globalHash = reader.readU64();
+
+      const std::uint64_t changeCount = reader.readVarint();
+      for (std::uint64_t i = 0; i < changeCount; i++) {
+        const auto          entityId   = static_cast<size_t>(reader.readVarint());
+        const std::uint64_t entityHash = reader.readU64();
+        record.changes.emplace_back(entityId, entityHash);
+      }
+
+      ticks.push_back(std::move(record));
+    }
+
+    return ticks;
+  }
+
+  void applyChanges(std::unordered_map<size_t, std::uint64_t>        &entityHashes,
+                    const std::vector<StateHasher::EntityHashChange> &changes) {
+    for (const auto &[entityId, entityHash] : changes) {
+      if (entityHash == StateHasher::REMOVED_ENTITY_HASH) {
+        entityHashes.erase(entityId);
+        continue;
+      }
+      entityHashes[entityId] = entityHash;
+    }
+  }
+} // namespace
+
+std::uint64_t StateHasher::hashEntity(const Entity &entity) {
+  std::uint64_t hash = combine(static_cast<std::uint64_t>(entity.id()),
+                               static_cast<std::uint64_t>(entity.tag()));
+
+  if (const auto cTransform = entity.getComponent<CTransform>()) {
+    hash = combine(hash, cTransform->topLeftCornerPos.x);
+    hash = combine(hash, cTransform->topLeftCornerPos.y);
+    hash = combine(hash, cTransform->velocity.x);
+    hash = combine(hash, cTransform->velocity.y);
+  }
+
+  if (const auto cLifespan = entity.getComponent<CLifespan>()) {
+    hash = combine(hash, cLifespan->birthTime);
+    hash = combine(hash, cLifespan->lifespan);
+  }
+
+  if (const auto cEffects = entity.getComponent<CEffects>()) {
+    for (const auto &[startTime, duration, type] : cEffects->getEffects()) {
+      hash = combine(hash, startTime);
+      hash = combine(hash, duration);
+      hash = combine(hash, static_cast<std::uint64_t>(type));
+    }
+  }
+
+  if (const auto cBounceTracker = entity.getComponent<CBounceTracker>()) {
+    hash = combine(hash, static_cast<std::uint64_t>(cBounceTracker->getBounces()));
+  }
+
+  // Zero marks a removed entity in the log.
+  return hash == REMOVED_ENTITY_HASH ? 1 : hash;
+}
+
+std::uint64_t StateHasher::update(MainSceneSimulation &simulation) {
+  // Every entity is rehashed; the cache only tells which hashes changed since the last tick.
+  m_updates += 1;
+  m_changes.clear();
+
+  for (const std::shared_ptr<Entity> &entity : simulation.getEntityManager().getEntities()) {
+    const std::uint64_t entityHash = hashEntity(*entity);
+    const auto [iterator, inserted] =
+        m_entityHashes.try_emplace(entity->id(), CachedEntityHash{entityHash, m_updates});
+    CachedEntityHash &cached = iterator->second;
+
+    if (inserted) {
+      m_entitySum += entityHash;
+      m_changes.emplace_back(entity->id(), entityHash);
+      continue;
+    }
+
+    cached.seenTick = m_updates;
+    if (cached.hash == entityHash) {
+      continue;
+    }
+
+    m_entitySum += entityHash - cached.hash;
+    cached.hash = entityHash;
+    m_changes.emplace_back(entity->id(), entityHash);
+  }
+
+  std::erase_if(m_entityHashes, [this](const auto &entry) -> bool {
+    const auto &[entityId, cached] = entry;
+    if (cached.seenTick == m_updates) {
+      return false;
+    }
+
+    m_entitySum -= cached.hash;
+    m_changes.emplace_back(entityId, REMOVED_ENTITY_HASH);
+    return true;
+  });
+
+  // Logged changes are sorted so identical runs produce identical files.
+  std::ranges::sort(m_changes);
+
+  m_globalHash = combine(simulation.getTick(), simulation.getCurrentTime());
+  m_globalHash = combine(m_globalHash, static_cast<std::uint64_t>(simulation.getScore()));
+  m_globalHash = combine(m_globalHash, static_cast<std::uint64_t>(simulation.getLives()));
+  m_globalHash = combine(m_globalHash, simulation.getTimeRemaining());
+  m_globalHash = combine(m_globalHash, static_cast<std::uint64_t>(simulation.isGameOver()));
+
+  m_stateHash = combine(m_globalHash, m_entitySum);
+  return m_stateHash;
+}
+
+std::uint64_t StateHasher::getStateHash() const {
+  return m_stateHash;
+}
+
+std::uint64_t StateHasher::getGlobalHash() const {
+  return m_globalHash;
+}
+
+const std::vector<StateHasher::EntityHashChange> &StateHasher::getChanges() const {
+  return m_changes;
+}
+
+StateHashLogWriter::StateHashLogWriter(const std::filesystem::path &path) :
+    m_file(path, std::ios::binary | std::ios::trunc) {
+  if (!m_file) {
+    throw BinaryFormatError("Could not open " + path.string() + " for writing");
+  }
+
+  BinaryWriter writer;
+  writer.writeU32(HASH_LOG_MAGIC);
+  writer.writeU16(HASH_LOG_VERSION);
+  m_file.write(reinterpret_cast<const char *>(writer.getBuffer().data()),
+               static_cast<std::streamsize>(writer.getBuffer().size()));
+}
+
+void StateHashLogWriter::write(const std::uint64_t tick, const StateHasher &hasher) {
+  BinaryWriter writer;
+  writer.writeVarint(tick);
+  writer.writeU64(hasher.getStateHash());
+  writer.writeU64(hasher.getGlobalHash());
+
+  writer.writeVarint(hasher.getChanges().size());
+  for (const auto &[entityId, entityHash] : hasher.getChanges()) {
+    writer.writeVarint(entityId);
+    writer.writeU64(entityHash);
+  }
+
+  m_file.write(reinterpret_cast<const char *>(writer.getBuffer().data()),
+               static_cast<std::streamsize>(writer.getBuffer().size()));
+}
+
+namespace StateHashHelpers {
+  std::optional<StateHashDivergence> findFirstDivergence(const std::filesystem::path &first,
+                                                         const std::filesystem::path &second) {
+    const std::vector<HashLogTick> firstTicks  = readHashLog(first);
+    const std::vector<HashLogTick> secondTicks = readHashLog(second);
+
+    std::unordered_map<size_t, std::uint64_t> firstEntities;
+    std::unordered_map<size_t, std::uint64_t> secondEntities;
+
+    const size_t commonTicks = std::min(firstTicks.size(), secondTicks.size());
+    for (size_t i = 0; i < commonTicks; i++) {
+      const HashLogTick &firstTick  = firstTicks[i];
+      const HashLogTick &secondTick = secondTicks[i];
+
+      applyChanges(firstEntities, firstTick.changes);
+      applyChanges(secondEntities, secondTick.changes);
+
+      if (firstTick.tick == secondTick.tick && firstTick.stateHash == secondTick.stateHash) {
+        continue;
+      }
+
+      StateHashDivergence divergence;
+      divergence.tick               = firstTick.tick;
+      divergence.globalStateDiffers = firstTick.globalHash != secondTick.globalHash;
+
+      std::set<size_t> entityIds;
+      for (const auto &[entityId, entityHash] : firstEntities) {
+        const auto other = secondEntities.find(entityId);
+        if (other == secondEntities.end() || other->second != entityHash) {
+          entityIds.insert(entityId);
+        }
+      }
+      for (const auto &[entityId, entityHash] : secondEntities) {
+        if (!firstEntities.contains(entityId)) {
+          entityIds.insert(entityId);
+        }
+      }
+
+      divergence.entityIds.assign(entityIds.begin(), entityIds.end());
+      return divergence;
+    }
+
+    if (firstTicks.size() == secondTicks.size()) {
+      return std::nullopt;
+    }
+
+    const std::vector<HashLogTick> &longer =
+        firstTicks.size() > secondTicks.size() ? firstTicks : secondTicks;
+
+    StateHashDivergence divergence;
+    divergence.tick             = longer[commonTicks].tick;
+    divergence.runLengthDiffers = true;
+    return divergence;
+  }
+} // namespace StateHashHelpers
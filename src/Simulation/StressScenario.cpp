@@ -0,0 +1,297 @@
+#include "../../includes/Simulation/StressScenario.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace {
+  constexpr std::array POPULATION_TAGS = {
+      EntityTags::Enemy,
+      EntityTags::Bullet,
+      EntityTags::Item,
+      EntityTags::SpeedBoost,
+      EntityTags::SlownessDebuff,
+  };
+
+  size_t interpolate(const size_t from, const size_t to, const double progress) {
+    const double count = static_cast<double>(from) +
+                         (static_cast<double>(to) - static_cast<double>(from)) * progress;
+    return static_cast<size_t>(std::lround(count));
+  }
+
+  /**
+   * Fits t ∝ n^k to two stages' mean system times and entity counts. Nothing when either
+   * stage did not measure the system or the entity count did not change.
+   */
+  std::optional<double> getScalingExponent(const StressScenario::StageResult &previous,
+                                           const StressScenario::StageResult &current,
+                                           const StressSystem                 system) {
+    const double previousTime  = previous.getMeanSystemTime(system);
+    const double currentTime   = current.getMeanSystemTime(system);
+    const double previousCount = previous.getMeanEntityCount();
+    const double currentCount  = current.getMeanEntityCount();
+    if (previousTime <= 0 || currentTime <= 0 || previousCount <= 0 || currentCount <= 0 ||
+        previousCount == currentCount) {
+      return std::nullopt;
+    }
+    return std::log(currentTime / previousTime) / std::log(currentCount / previousCount);
+  }
+
+  nlohmann::json toJson(const StressPopulation &population) {
+    return {
+        {"enemies", population.enemies},
+        {"bullets", population.bullets},
+        {"items", population.items},
+        {"speedBoosts", population.speedBoosts},
+        {"slownessDebuffs", population.slownessDebuffs},
+    };
+  }
+} // namespace
+
+double StressScenario::StageResult::getMeanSystemTime(const StressSystem system) const {
+  if (frameTimes.getCount() == 0) {
+    return 0;
+  }
+  return static_cast<double>(totalSystemTimes[static_cast<size_t>(system)]) /
+         static_cast<double>(frameTimes.getCount());
+}
+
+double StressScenario::StageResult::getMeanEntityCount() const {
+  if (frameTimes.getCount() == 0) {
+    return 0;
+  }
+  return static_cast<double>(totalEntityCount) / static_cast<double>(frameTimes.getCount());
+}
+
+StressScenario::StressScenario(const StressConfig &config,
+                               const std::uint32_t frameTimeTarget) :
+    m_stages(config.stages) {
+  const std::uint32_t hitchThreshold =
+      frameTimeTarget * FrameTimeHistogram::HITCH_TARGET_MULTIPLE;
+  for (const StressStageConfig &stage : m_stages) {
+    m_results.push_back({
+        .population = stage.population,
+        .frameTimes = FrameTimeHistogram(hitchThreshold),
+    });
+  }
+}
+
+StressPopulation StressScenario::getTargetPopulation() const {
+  if (isFinished()) {
+    return m_stages.empty() ? StressPopulation{} : m_stages.back().population;
+  }
+
+  const StressStageConfig &stage = m_stages[m_stageIndex];
+  if (!isRamping()) {
+    return stage.population;
+  }
+
+  // The last ramp frame reaches the stage's population.
+  const double progress = static_cast<double>(m_stageFrame + 1) /
+                          static_cast<double>(stage.rampFrames);
+  const auto ramp = [&](size_t StressPopulation::*count) -> size_t {
+    return interpolate(m_rampStart.*count, stage.population.*count, progress);
+  };
+  return {
+      .enemies         = ramp(&StressPopulation::enemies),
+      .bullets         = ramp(&StressPopulation::bullets),
+      .items           = ramp(&StressPopulation::items),
+      .speedBoosts     = ramp(&StressPopulation::speedBoosts),
+      .slownessDebuffs = ramp(&StressPopulation::slownessDebuffs),
+  };
+}
+
+void StressScenario::applyTargetPopulation(MainSceneSimulation &simulation) const {
+  const StressPopulation target        = getTargetPopulation();
+  EntityManager         &entityManager = simulation.getEntityManager();
+
+  for (const EntityTags tag : POPULATION_TAGS) {
+    size_t activeCount = 0;
+    for (const std::shared_ptr<Entity> &entity : entityManager.getEntities(tag)) {
+      activeCount += entity->isActive() ? 1 : 0;
+    }
+
+    const size_t targetCount = StressHelpers::getTagCount(target, tag);
+    if (activeCount < targetCount) {
+      simulation.spawnUnchecked(tag, targetCount - activeCount);
+    } else if (activeCount > targetCount) {
+      simulation.destroyOldest(tag, activeCount - targetCount);
+    }
+  }
+
+  entityManager.update();
+}
+
+void StressScenario::recordFrame(const StressFrameSample &sample) {
+  if (isFinished()) {
+    return;
+  }
+
+  if (!isRamping()) {
+    StageResult &result = m_results[m_stageIndex];
+    result.frameTimes.record(sample.frameTime);
+    for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+      result.totalSystemTimes[system] += sample.systemTimes[system];
+    }
+    result.totalEntityCount += sample.entityCount;
+  }
+
+  const StressStageConfig &stage = m_stages[m_stageIndex];
+  m_stageFrame += 1;
+  if (m_stageFrame < stage.rampFrames + stage.holdFrames) {
+    return;
+  }
+
+  m_rampStart  = stage.population;
+  m_stageFrame = 0;
+  m_stageIndex++;
+}
+
+bool StressScenario::isFinished() const {
+  return m_stageIndex >= m_stages.size();
+}
+
+bool StressScenario::isRamping() const {
+  return !isFinished() && m_stageFrame < m_stages[m_stageIndex].rampFrames;
+}
+
+size_t StressScenario::getStageIndex() const {
+  return m_stageIndex;
+}
+
+size_t StressScenario::getStageCount() const {
+  return m_stages.size();
+}
+
+const std::vector<StressScenario::StageResult> &StressScenario::getResults() const {
+  return m_results;
+}
+
+void StressScenario::saveReport(const std::filesystem::path &path) const {
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("Could not open " + path.string() + " for writing");
+  }
+
+  if (path.extension() == ".csv") {
+    file << "stage,enemies,bullets,items,speed_boosts,slowness_debuffs,mean_entities,frames";
+    for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+      file << ',' << StressHelpers::getSystemName(static_cast<StressSystem>(system)) << "_us";
+    }
+    file << ",frame_p50_us,frame_p99_us,frame_max_us,hitches";
+    for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+      file << ',' << StressHelpers::getSystemName(static_cast<StressSystem>(system))
+           << "_scaling";
+    }
+    file << '\n';
+
+    for (size_t stage = 0; stage < m_results.size(); stage++) {
+      const StageResult        &result     = m_results[stage];
+      const StressPopulation   &population = result.population;
+      const FrameTimeHistogram &frameTimes = result.frameTimes;
+      file << stage << ',' << population.enemies << ',' << population.bullets << ','
+           << population.items << ',' << population.speedBoosts << ','
+           << population.slownessDebuffs << ',' << result.getMeanEntityCount() << ','
+           << frameTimes.getCount();
+      for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+        file << ',' << result.getMeanSystemTime(static_cast<StressSystem>(system));
+      }
+      file << ',' << frameTimes.getPercentile(50) << ',' << frameTimes.getPercentile(99) << ','
+           << frameTimes.getMax() << ',' << frameTimes.getHitchCount();
+      for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+        file << ',';
+        if (stage == 0) {
+          continue;
+        }
+        const std::optional<double> exponent = getScalingExponent(
+            m_results[stage - 1], result, static_cast<StressSystem>(system));
+        if (exponent.has_value()) {
+          file << *exponent;
+        }
+      }
+      file << '\n';
+    }
+  } else {
+    nlohmann::json stages = nlohmann::json::array();
+    for (size_t stage = 0; stage < m_results.size(); stage++) {
+      const StageResult        &result     = m_results[stage];
+      const FrameTimeHistogram &frameTimes = result.frameTimes;
+
+      nlohmann::json systemTimes = nlohmann::json::object();
+      nlohmann::json scaling     = nlohmann::json::object();
+      for (size_t system = 0; system < STRESS_SYSTEM_COUNT; system++) {
+        const auto        stressSystem = static_cast<StressSystem>(system);
+        const std::string name(StressHelpers::getSystemName(stressSystem));
+        systemTimes[name] = result.getMeanSystemTime(stressSystem);
+
+        const std::optional<double> exponent =
+            stage == 0 ? std::nullopt
+                       : getScalingExponent(m_results[stage - 1], result, stressSystem);
+        scaling[name] = exponent.has_value() ? nlohmann::json(*exponent)
+                                             : nlohmann::json(nullptr);
+      }
+
+      stages.push_back({
+          {"population", toJson(result.population)},
+          {"meanEntities", result.getMeanEntityCount()},
+          {"frames", frameTimes.getCount()},
+          {"meanSystemUs", systemTimes},
+          {"frameP50Us", frameTimes.getPercentile(50)},
+          {"frameP99Us", frameTimes.getPercentile(99)},
+          {"frameMaxUs", frameTimes.getMax()},
+          {"hitches", frameTimes.getHitchCount()},
+          {"scalingExponents", scaling},
+      });
+    }
+
+    const std::uint32_t hitchThreshold =
+        m_results.empty() ? 0 : m_results.front().frameTimes.getHitchThreshold();
+    file << nlohmann::json{{"hitchThresholdUs", hitchThreshold}, {"stages", stages}}.dump(2)
+         << '\n';
+  }
+
+  if (!file) {
+    throw std::runtime_error("Could not write " + path.string());
+  }
+}
+
+namespace StressHelpers {
+  std::string_view getSystemName(const StressSystem system) {
+    switch (system) {
+      case StressSystem::POPULATION:
+        return "population";
+      case StressSystem::MOVEMENT:
+        return "movement";
+      case StressSystem::COLLISION:
+        return "collision";
+      case StressSystem::LIFESPAN:
+        return "lifespan";
+      case StressSystem::EFFECTS:
+        return "effects";
+      case StressSystem::RENDER:
+        return "render";
+    }
+    return "unknown";
+  }
+
+  size_t getTagCount(const StressPopulation &population, const EntityTags tag) {
+    switch (tag) {
+      case EntityTags::Enemy:
+        return population.enemies;
+      case EntityTags::Bullet:
+        return population.bullets;
+      case EntityTags::Item:
+        return population.items;
+      case EntityTags::SpeedBoost:
+        return population.speedBoosts;
+      case EntityTags::SlownessDebuff:
+        return population.slownessDebuffs;
+      default:
+        return 0;
+    }
+  }
+} // namespace StressHelpers
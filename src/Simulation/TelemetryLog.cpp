@@ -0,0 +1,300 @@
+#include "../../includes/Simulation/TelemetryLog.hpp"
+#include "../../includes/Helpers/BinaryIO.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Blocks are written and mapped as native 32-bit values.
+static_assert(std::endian::native == std::endian::little);
+
+namespace {
+  // Each block starts with its row count and a reserved word, ahead of the columns.
+  constexpr size_t BLOCK_HEADER_VALUES = 2;
+
+  constexpr size_t FILE_HEADER_SIZE = 16;
+} // namespace
+
+std::uint32_t &TelemetryRow::operator[](const TelemetryColumn column) {
+  return values[static_cast<size_t>(column)];
+}
+
+TelemetryRow TelemetryRow::capture(MainSceneSimulation &simulation,
+                                   const std::uint32_t  frameTime,
+                                   const std::uint32_t  updateTime) {
+  EntityManager                        &entities = simulation.getEntityManager();
+  const MainSceneSimulation::TickStats &stats    = simulation.getTickStats();
+
+  auto count = [&entities](const EntityTags tag) -> std::uint32_t {
+    return static_cast<std::uint32_t>(entities.getEntities(tag).size());
+  };
+
+  const auto tick        = static_cast<std::uint32_t>(simulation.getTick());
+  const auto entityCount = static_cast<std::uint32_t>(entities.getEntities().size());
+  const auto score       = static_cast<std::uint32_t>(std::max(0, simulation.getScore()));
+
+  TelemetryRow row;
+  row[TelemetryColumn::TICK]                  = tick;
+  row[TelemetryColumn::FRAME_TIME_US]         = frameTime;
+  row[TelemetryColumn::UPDATE_TIME_US]        = updateTime;
+  row[TelemetryColumn::ENTITY_COUNT]          = entityCount;
+  row[TelemetryColumn::ENEMY_COUNT]           = count(EntityTags::Enemy);
+  row[TelemetryColumn::BULLET_COUNT]          = count(EntityTags::Bullet);
+  row[TelemetryColumn::ITEM_COUNT]            = count(EntityTags::Item);
+  row[TelemetryColumn::SPEED_BOOST_COUNT]     = count(EntityTags::SpeedBoost);
+  row[TelemetryColumn::SLOWNESS_DEBUFF_COUNT] = count(EntityTags::SlownessDebuff);
+  row[TelemetryColumn::COLLISION_CHECKS]      = stats.collisionChecks;
+  row[TelemetryColumn::COLLISIONS]            = stats.collisions;
+  row[TelemetryColumn::SPAWN_ATTEMPTS]        = stats.spawnAttempts;
+  row[TelemetryColumn::SPAWNS]                = stats.spawns;
+  row[TelemetryColumn::SPAWN_PERCENTAGE]      = simulation.getSpawnBudget().spawnPercentage;
+  row[TelemetryColumn::CULLED]                = stats.culled;
+  row[TelemetryColumn::SCORE]                 = score;
+  return row;
+}
+
+TelemetryLogWriter::TelemetryLogWriter(const std::filesystem::path &path,
+                                       const size_t                 rowsPerBlock) :
+    m_file(path, std::ios::binary | std::ios::trunc),
+    m_rowsPerBlock(std::max<size_t>(2, rowsPerBlock + rowsPerBlock % 2)),
+    m_block(BLOCK_HEADER_VALUES + TELEMETRY_COLUMN_COUNT * m_rowsPerBlock) {
+  if (!m_file) {
+    throw BinaryFormatError("Could not open " + path.string() + " for writing");
+  }
+
+  BinaryWriter columnNames;
+  for (size_t column = 0; column < TELEMETRY_COLUMN_COUNT; column++) {
+    const auto name = TelemetryHelpers::getColumnName(static_cast<TelemetryColumn>(column));
+    columnNames.writeString(std::string(name));
+  }
+
+  // Blocks start 8-byte aligned so readers can view their columns in place.
+  const size_t dataOffset = (FILE_HEADER_SIZE + columnNames.getBuffer().size() + 7) / 8 * 8;
+
+  BinaryWriter header;
+  header.writeU32(MAGIC);
+  header.writeU16(VERSION);
+  header.writeU16(static_cast<std::uint16_t>(TELEMETRY_COLUMN_COUNT));
+  header.writeU32(static_cast<std::uint32_t>(m_rowsPerBlock));
+  header.writeU32(static_cast<std::uint32_t>(dataOffset));
+  header.writeBytes(columnNames.getBuffer().data(), columnNames.getBuffer().size());
+  while (header.getBuffer().size() < dataOffset) {
+    header.writeU8(0);
+  }
+
+  m_file.write(reinterpret_cast<const char *>(header.getBuffer().data()),
+               static_cast<std::streamsize>(header.getBuffer().size()));
+
+  m_flushThread = std::thread(&TelemetryLogWriter::flushLoop, this);
+}
+
+TelemetryLogWriter::~TelemetryLogWriter() {
+  if (m_rowCount > 0) {
+    flushBlock();
+  }
+
+  {
+    std::lock_guard lock(m_mutex);
+    m_stopping = true;
+  }
+  m_blocksPending.notify_one();
+  m_flushThread.join();
+}
+
+void TelemetryLogWriter::write(const TelemetryRow &row) {
+  std::uint32_t *columns = m_block.data() + BLOCK_HEADER_VALUES;
+  for (size_t column = 0; column < TELEMETRY_COLUMN_COUNT; column++) {
+    columns[column * m_rowsPerBlock + m_rowCount] = row.values[column];
+  }
+
+  m_rowCount += 1;
+  if (m_rowCount == m_rowsPerBlock) {
+    flushBlock();
+  }
+}
+
+void TelemetryLogWriter::flushBlock() {
+  // A recycled buffer still holds an old block's rows past the new row count.
+  if (m_rowCount < m_rowsPerBlock) {
+    std::uint32_t *columns = m_block.data() + BLOCK_HEADER_VALUES;
+    for (size_t column = 0; column < TELEMETRY_COLUMN_COUNT; column++) {
+      std::uint32_t *values = columns + column * m_rowsPerBlock;
+      std::fill(values + m_rowCount, values + m_rowsPerBlock, 0);
+    }
+  }
+
+  m_block[0] = static_cast<std::uint32_t>(m_rowCount);
+  m_block[1] = 0;
+  m_rowCount = 0;
+
+  {
+    std::lock_guard lock(m_mutex);
+    m_pendingBlocks.push_back(std::move(m_block));
+    if (m_freeBlocks.empty()) {
+      m_block.assign(BLOCK_HEADER_VALUES + TELEMETRY_COLUMN_COUNT * m_rowsPerBlock, 0);
+    } else {
+      m_block = std::move(m_freeBlocks.back());
+      m_freeBlocks.pop_back();
+    }
+  }
+  m_blocksPending.notify_one();
+}
+
+void TelemetryLogWriter::flushLoop() {
+  std::vector<std::vector<std::uint32_t>> blocks;
+
+  while (true) {
+    bool stopping = false;
+    {
+      std::unique_lock lock(m_mutex);
+      m_blocksPending.wait(lock, [this] { return m_stopping || !m_pendingBlocks.empty(); });
+      blocks.swap(m_pendingBlocks);
+      stopping = m_stopping;
+    }
+
+    for (const std::vector<std::uint32_t> &block : blocks) {
+      m_file.write(reinterpret_cast<const char *>(block.data()),
+                   static_cast<std::streamsize>(block.size() * sizeof(std::uint32_t)));
+    }
+
+    {
+      std::lock_guard lock(m_mutex);
+      for (std::vector<std::uint32_t> &block : blocks) {
+        m_freeBlocks.push_back(std::move(block));
+      }
+    }
+    blocks.clear();
+
+    if (stopping) {
+      m_file.flush();
+      return;
+    }
+  }
+}
+
+TelemetryLogReader::TelemetryLogReader(const std::filesystem::path &path) {
+  const int file = open(path.c_str(), O_RDONLY);
+  if (file < 0) {
+    throw BinaryFormatError("Could not open " + path.string() + " for reading");
+  }
+
+  struct stat fileStat {};
+  if (fstat(file, &fileStat) != 0 || fileStat.st_size == 0) {
+    close(file);
+    throw BinaryFormatError(path.string() + " is empty or unreadable");
+  }
+
+  m_size              = static_cast<size_t>(fileStat.st_size);
+  void *const mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+  close(file);
+  if (mapping == MAP_FAILED) {
+    throw BinaryFormatError("Could not map " + path.string());
+  }
+  m_data = static_cast<const std::uint8_t *>(mapping);
+
+  try {
+    BinaryReader reader(m_data, m_size);
+    if (reader.readU32() != TelemetryLogWriter::MAGIC) {
+      throw BinaryFormatError(path.string() + " is not a telemetry log");
+    }
+
+    const std::uint16_t version = reader.readU16();
+    if (version != TelemetryLogWriter::VERSION) {
+      throw BinaryFormatError("Unsupported telemetry log version " + std::to_string(version));
+    }
+
+    const std::uint16_t columnCount = reader.readU16();
+    m_rowsPerBlock                  = reader.readU32();
+    m_dataOffset                    = reader.readU32();
+    for (std::uint16_t column = 0; column < columnCount; column++) {
+      m_columnNames.push_back(reader.readString());
+    }
+
+    if (m_dataOffset % 8 != 0 || m_dataOffset > m_size || m_rowsPerBlock == 0) {
+      throw BinaryFormatError(path.string() + " has a malformed header");
+    }
+  } catch (const BinaryFormatError &) {
+    munmap(const_cast<std::uint8_t *>(m_data), m_size);
+    throw;
+  }
+
+  // A trailing partial block, e.g. from a crashed session, is ignored.
+  m_blockSize  = (BLOCK_HEADER_VALUES + m_columnNames.size() * m_rowsPerBlock) * 4;
+  m_blockCount = (m_size - m_dataOffset) / m_blockSize;
+}
+
+TelemetryLogReader::~TelemetryLogReader() {
+  munmap(const_cast<std::uint8_t *>(m_data), m_size);
+}
+
+size_t TelemetryLogReader::getBlockCount() const {
+  return m_blockCount;
+}
+
+size_t TelemetryLogReader::getRowCount() const {
+  size_t rowCount = 0;
+  for (size_t block = 0; block < m_blockCount; block++) {
+    rowCount += getColumn(block, 0).size();
+  }
+  return rowCount;
+}
+
+const std::vector<std::string> &TelemetryLogReader::getColumnNames() const {
+  return m_columnNames;
+}
+
+std::span<const std::uint32_t> TelemetryLogReader::getColumn(const size_t block,
+                                                             const size_t column) const {
+  const auto *values =
+      reinterpret_cast<const std::uint32_t *>(m_data + m_dataOffset + block * m_blockSize);
+  const size_t rowCount = std::min<size_t>(values[0], m_rowsPerBlock);
+
+  return {values + BLOCK_HEADER_VALUES + column * m_rowsPerBlock, rowCount};
+}
+
+size_t TelemetryLogReader::findColumn(const std::string_view name) const {
+  return std::ranges::find(m_columnNames, name) - m_columnNames.begin();
+}
+
+namespace TelemetryHelpers {
+  std::string_view getColumnName(const TelemetryColumn column) {
+    switch (column) {
+      case TelemetryColumn::TICK:
+        return "tick";
+      case TelemetryColumn::FRAME_TIME_US:
+        return "frame_time_us";
+      case TelemetryColumn::UPDATE_TIME_US:
+        return "update_time_us";
+      case TelemetryColumn::ENTITY_COUNT:
+        return "entity_count";
+      case TelemetryColumn::ENEMY_COUNT:
+        return "enemy_count";
+      case TelemetryColumn::BULLET_COUNT:
+        return "bullet_count";
+      case TelemetryColumn::ITEM_COUNT:
+        return "item_count";
+      case TelemetryColumn::SPEED_BOOST_COUNT:
+        return "speed_boost_count";
+      case TelemetryColumn::SLOWNESS_DEBUFF_COUNT:
+        return "slowness_debuff_count";
+      case TelemetryColumn::COLLISION_CHECKS:
+        return "collision_checks";
+      case TelemetryColumn::COLLISIONS:
+        return "collisions";
+      case TelemetryColumn::SPAWN_ATTEMPTS:
+        return "spawn_attempts";
+      case TelemetryColumn::SPAWNS:
+        return "spawns";
+      case TelemetryColumn::SPAWN_PERCENTAGE:
+        return "spawn_percentage";
+      case TelemetryColumn::CULLED:
+        return "culled";
+      case TelemetryColumn::SCORE:
+        return "score";
+    }
+    return "unknown";
+  }
+} // namespace TelemetryHelpers
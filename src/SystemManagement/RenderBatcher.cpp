@@ -0,0 +1,115 @@
+#include "../../includes/SystemManagement/RenderBatcher.hpp"
+
+RenderBatcher::RenderBatcher(SoftwareRenderer *softwareRenderer) :
+    m_softwareRenderer(softwareRenderer) {}
+
+RenderBatcher::Batch &RenderBatcher::getBatch(SDL_Texture        *texture,
+                                              const SDL_BlendMode blendMode) {
+  // There are only ever a few textures and blend modes, so a linear search is the fastest.
+  for (Batch &batch : m_batches) {
+    if (batch.texture == texture && batch.blendMode == blendMode) {
+      return batch;
+    }
+  }
+
+  m_batches.push_back({.texture = texture, .blendMode = blendMode});
+  return m_batches.back();
+}
+
+void RenderBatcher::addQuad(const SDL_Rect     &rect,
+                            const SDL_Color     color,
+                            SDL_Texture        *texture,
+                            const SDL_FRect    &texCoords,
+                            const SDL_BlendMode blendMode) {
+  Batch &batch = getBatch(texture, blendMode);
+
+  const float left   = static_cast<float>(rect.x);
+  const float top    = static_cast<float>(rect.y);
+  const float right  = static_cast<float>(rect.x + rect.w);
+  const float bottom = static_cast<float>(rect.y + rect.h);
+
+  const float texLeft   = texCoords.x;
+  const float texTop    = texCoords.y;
+  const float texRight  = texCoords.x + texCoords.w;
+  const float texBottom = texCoords.y + texCoords.h;
+
+  const int first = static_cast<int>(batch.vertices.size());
+  batch.vertices.push_back({{left, top}, color, {texLeft, texTop}});
+  batch.vertices.push_back({{right, top}, color, {texRight, texTop}});
+  batch.vertices.push_back({{right, bottom}, color, {texRight, texBottom}});
+  batch.vertices.push_back({{left, bottom}, color, {texLeft, texBottom}});
+
+  // Two triangles that share the quad's diagonal.
+  for (const int corner : {0, 1, 2, 2, 3, 0}) {
+    batch.indices.push_back(first + corner);
+  }
+}
+
+void RenderBatcher::addQuads(const SDL_Vertex   *vertices,
+                             const size_t        quadCount,
+                             SDL_Texture        *texture,
+                             const SDL_BlendMode blendMode) {
+  Batch &batch = getBatch(texture, blendMode);
+
+  const size_t firstQuad = batch.vertices.size() / 4;
+  batch.vertices.insert(batch.vertices.end(), vertices, vertices + quadCount * 4);
+
+  batch.indices.resize((firstQuad + quadCount) * 6);
+  int *indices = batch.indices.data() + firstQuad * 6;
+  for (size_t quad = 0; quad < quadCount; quad++) {
+    const int first = static_cast<int>((firstQuad + quad) * 4);
+    indices[0]      = first;
+    indices[1]      = first + 1;
+    indices[2]      = first + 2;
+    indices[3]      = first + 2;
+    indices[4]      = first + 3;
+    indices[5]      = first;
+    indices += 6;
+  }
+}
+
+void RenderBatcher::flush(SDL_Renderer *renderer) {
+  m_drawCallCount = 0;
+
+  for (Batch &batch : m_batches) {
+    if (batch.vertices.empty()) {
+      continue;
+    }
+
+    if (m_softwareRenderer != nullptr) {
+      m_softwareRenderer->renderGeometry(batch.texture,
+                                         batch.vertices.data(),
+                                         static_cast<int>(batch.vertices.size()),
+                                         batch.blendMode);
+    } else {
+      drawBatch(renderer, batch);
+    }
+    m_drawCallCount += 1;
+
+    batch.vertices.clear();
+    batch.indices.clear();
+  }
+}
+
+void RenderBatcher::drawBatch(SDL_Renderer *renderer, const Batch &batch) {
+  // Solid colour geometry is drawn with the renderer's blend mode, textured geometry with
+  // the texture's.
+  if (batch.texture == nullptr) {
+    SDL_SetRenderDrawBlendMode(renderer, batch.blendMode);
+  } else {
+    SDL_SetTextureBlendMode(batch.texture, batch.blendMode);
+  }
+
+  if (SDL_RenderGeometry(renderer,
+                         batch.texture,
+                         batch.vertices.data(),
+                         static_cast<int>(batch.vertices.size()),
+                         batch.indices.data(),
+                         static_cast<int>(batch.indices.size())) != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER, "Could not draw a batch: %s", SDL_GetError());
+  }
+}
+
+size_t RenderBatcher::getDrawCallCount() const {
+  return m_drawCallCount;
+}
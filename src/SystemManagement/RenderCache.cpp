@@ -0,0 +1,73 @@
+#include "../../includes/SystemManagement/RenderCache.hpp"
+
+RenderCache::RenderCache(SDL_Renderer *renderer, const SoftwareRenderer *softwareRenderer) :
+    m_renderer(renderer), m_enabled(softwareRenderer == nullptr) {}
+
+RenderCache::~RenderCache() {
+  destroyTexture();
+}
+
+void RenderCache::destroyTexture() {
+  if (m_texture != nullptr) {
+    SDL_DestroyTexture(m_texture);
+    m_texture = nullptr;
+  }
+}
+
+void RenderCache::createTexture(const int width, const int height) {
+  destroyTexture();
+  m_width  = width;
+  m_height = height;
+
+  if (!SDL_RenderTargetSupported(m_renderer)) {
+    SDL_LogWarn(SDL_LOG_CATEGORY_RENDER, "Render targets are not supported, drawing uncached");
+    return;
+  }
+
+  m_texture = SDL_CreateTexture(
+      m_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+  if (m_texture == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER,
+                 "Could not create a %dx%d render cache, drawing uncached: %s",
+                 width,
+                 height,
+                 SDL_GetError());
+    return;
+  }
+
+  // The cached frame replaces the screen's contents rather than blending over them.
+  SDL_SetTextureBlendMode(m_texture, SDL_BLENDMODE_NONE);
+}
+
+void RenderCache::invalidate() {
+  m_valid = false;
+}
+
+void RenderCache::render(const std::function<void()> &draw) {
+  if (!m_enabled) {
+    draw();
+    return;
+  }
+
+  int width  = 0;
+  int height = 0;
+  SDL_GetRendererOutputSize(m_renderer, &width, &height);
+  if (width != m_width || height != m_height) {
+    createTexture(width, height);
+    m_valid = false;
+  }
+
+  if (m_texture == nullptr) {
+    draw();
+    return;
+  }
+
+  if (!m_valid) {
+    SDL_SetRenderTarget(m_renderer, m_texture);
+    draw();
+    SDL_SetRenderTarget(m_renderer, nullptr);
+    m_valid = true;
+  }
+
+  SDL_RenderCopy(m_renderer, m_texture, nullptr, nullptr);
+}
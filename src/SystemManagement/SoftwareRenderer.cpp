@@ -0,0 +1,151 @@
+#include "../../includes/SystemManagement/SoftwareRenderer.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace {
+  std::uint32_t packColor(const SDL_Color &color) {
+    return SoftwareRasterizer::packColor(color.r, color.g, color.b, color.a);
+  }
+
+  int roundToPixel(const float coordinate) {
+    return static_cast<int>(std::lround(coordinate));
+  }
+} // namespace
+
+SoftwareRenderer::SoftwareRenderer(SDL_Renderer *renderer, JobSystem &jobSystem) :
+    m_renderer(renderer), m_rasterizer(jobSystem) {}
+
+SoftwareRenderer::~SoftwareRenderer() {
+  destroyFrameTexture();
+}
+
+void SoftwareRenderer::destroyFrameTexture() {
+  if (m_frameTexture != nullptr) {
+    SDL_DestroyTexture(m_frameTexture);
+    m_frameTexture = nullptr;
+  }
+}
+
+void SoftwareRenderer::registerTexture(const SDL_Texture *texture, SDL_Surface *surface) {
+  SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+  if (converted == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_RENDER,
+                 "Could not copy a texture for the software renderer: %s",
+                 SDL_GetError());
+    return;
+  }
+
+  SoftwareRasterizer::Image image = {.width = converted->w, .height = converted->h};
+  image.pixels.resize(static_cast<size_t>(converted->w) * static_cast<size_t>(converted->h));
+
+  SDL_LockSurface(converted);
+  const auto  *rows     = static_cast<const std::uint8_t *>(converted->pixels);
+  const size_t rowBytes = static_cast<size_t>(converted->w) * sizeof(std::uint32_t);
+  for (int y = 0; y < converted->h; y++) {
+    std::memcpy(image.pixels.data() + static_cast<size_t>(y) * converted->w,
+                rows + static_cast<size_t>(y) * converted->pitch,
+                rowBytes);
+  }
+  SDL_UnlockSurface(converted);
+  SDL_FreeSurface(converted);
+
+  m_images[texture] = std::move(image);
+}
+
+void SoftwareRenderer::resize(const int width, const int height) {
+  m_rasterizer.resize(width, height);
+}
+
+void SoftwareRenderer::clear(const SDL_Color color) {
+  if (m_renderer != nullptr) {
+    int width  = 0;
+    int height = 0;
+    SDL_GetRendererOutputSize(m_renderer, &width, &height);
+    m_rasterizer.resize(width, height);
+  }
+  m_rasterizer.clear(packColor(color));
+}
+
+void SoftwareRenderer::renderGeometry(SDL_Texture        *texture,
+                                      const SDL_Vertex   *vertices,
+                                      const int           vertexCount,
+                                      const SDL_BlendMode blendMode) {
+  const SoftwareRasterizer::Image *image = nullptr;
+  if (texture != nullptr) {
+    const auto registered = m_images.find(texture);
+    if (registered == m_images.end()) {
+      return;
+    }
+    image = &registered->second;
+  }
+
+  for (int first = 0; first + 3 < vertexCount; first += 4) {
+    const SDL_Vertex &topLeft     = vertices[first];
+    const SDL_Vertex &bottomRight = vertices[first + 2];
+    m_rasterizer.addQuad({
+        .left      = roundToPixel(topLeft.position.x),
+        .top       = roundToPixel(topLeft.position.y),
+        .right     = roundToPixel(bottomRight.position.x),
+        .bottom    = roundToPixel(bottomRight.position.y),
+        .color     = packColor(topLeft.color),
+        .image     = image,
+        .texLeft   = topLeft.tex_coord.x,
+        .texTop    = topLeft.tex_coord.y,
+        .texRight  = bottomRight.tex_coord.x,
+        .texBottom = bottomRight.tex_coord.y,
+        .blend     = blendMode != SDL_BLENDMODE_NONE,
+    });
+  }
+}
+
+void SoftwareRenderer::flush() {
+  m_rasterizer.flush();
+}
+
+void SoftwareRenderer::present() {
+  flush();
+  if (m_renderer == nullptr) {
+    return;
+  }
+
+  const int width  = m_rasterizer.getWidth();
+  const int height = m_rasterizer.getHeight();
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  int textureWidth  = 0;
+  int textureHeight = 0;
+  if (m_frameTexture != nullptr) {
+    SDL_QueryTexture(m_frameTexture, nullptr, nullptr, &textureWidth, &textureHeight);
+  }
+  if (textureWidth != width || textureHeight != height) {
+    destroyFrameTexture();
+    m_frameTexture = SDL_CreateTexture(
+        m_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (m_frameTexture == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_RENDER,
+                   "Could not create a %dx%d frame texture: %s",
+                   width,
+                   height,
+                   SDL_GetError());
+      return;
+    }
+
+    // The rasterizer has already blended the frame, so it is copied to the screen as is.
+    SDL_SetTextureBlendMode(m_frameTexture, SDL_BLENDMODE_NONE);
+  }
+
+  SDL_UpdateTexture(m_frameTexture,
+                    nullptr,
+                    m_rasterizer.getPixels(),
+                    width * static_cast<int>(sizeof(std::uint32_t)));
+  SDL_RenderCopy(m_renderer, m_frameTexture, nullptr, nullptr);
+  SDL_RenderPresent(m_renderer);
+}
+
+const SoftwareRasterizer &SoftwareRenderer::getRasterizer() const {
+  return m_rasterizer;
+}
@@ -0,0 +1,52 @@
+#include "../../includes/SystemManagement/TextRenderer.hpp"
+
+TextRenderer::TextRenderer(SDL_Renderer      *renderer,
+                           const FontManager &fontManager,
+                           SoftwareRenderer  *softwareRenderer) :
+    m_renderer(renderer), m_batcher(softwareRenderer) {
+  for (TTF_Font *font :
+       {fontManager.getFontSm(), fontManager.getFontMd(), fontManager.getFontLg()}) {
+    // Fonts that failed to load are reported by the FontManager; their text is skipped.
+    if (font == nullptr) {
+      continue;
+    }
+    m_atlases[font] = std::make_unique<GlyphAtlas>(renderer, font, softwareRenderer);
+  }
+}
+
+const GlyphAtlas *TextRenderer::getAtlas(const TTF_Font *font) const {
+  const auto atlas = m_atlases.find(font);
+  return atlas == m_atlases.end() ? nullptr : atlas->second.get();
+}
+
+void TextRenderer::renderLine(const TTF_Font        *font,
+                              const std::string_view text,
+                              const SDL_Color       &color,
+                              const Vec2            &position) {
+  const GlyphAtlas *atlas = getAtlas(font);
+  if (atlas == nullptr) {
+    return;
+  }
+
+  const int penY     = static_cast<int>(position.y);
+  int       penX     = static_cast<int>(position.x);
+  char      previous = '\0';
+  for (const char character : text) {
+    const GlyphAtlas::Glyph *glyph = atlas->getGlyph(character);
+    if (glyph == nullptr) {
+      continue;
+    }
+
+    penX += atlas->getKerning(previous, character);
+
+    const SDL_Rect rect = {.x = penX, .y = penY, .w = glyph->width, .h = glyph->height};
+    m_batcher.addQuad(rect, color, atlas->getTexture(), glyph->texCoords);
+
+    penX += glyph->advance;
+    previous = character;
+  }
+}
+
+void TextRenderer::flush() {
+  m_batcher.flush(m_renderer);
+}
@@ -9,13 +9,18 @@
 
 typedef std::filesystem::path Path;
 
-VideoManager::VideoManager(ConfigManager &configManager) :
+VideoManager::VideoManager(ConfigManager &configManager, JobSystem &jobSystem) :
     m_configManager(configManager) {
   initializeVideoSystem();
   m_window   = createWindow();
   m_renderer = createRenderer();
 
   setupRenderer();
+
+  if (m_configManager.getRenderConfig().backend == RenderBackend::SOFTWARE) {
+    m_softwareRenderer = std::make_unique<SoftwareRenderer>(m_renderer, jobSystem);
+    SDL_LogInfo(SDL_LOG_CATEGORY_VIDEO, "Drawing frames with the software renderer");
+  }
 }
 
 void VideoManager::initializeVideoSystem() {
@@ -86,7 +91,15 @@ SDL_Renderer *VideoManager::createRenderer() const {
     throw std::runtime_error("Window is not initialized");
   }
 
-  SDL_Renderer *renderer = SDL_CreateRenderer(m_window, -1, SDL_RENDERER_ACCELERATED);
+  Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+#ifndef __EMSCRIPTEN__
+  // The browser already paces the web build's main loop to the display.
+  if (m_configManager.getFramePacingConfig().mode == FramePacingMode::VSYNC) {
+    rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+  }
+#endif
+
+  SDL_Renderer *renderer = SDL_CreateRenderer(m_window, -1, rendererFlags);
   if (renderer == nullptr) {
     SDL_LogError(SDL_LOG_CATEGORY_VIDEO, "Renderer could not be created: %s", SDL_GetError());
     throw std::runtime_error("Renderer could not be created");
@@ -121,7 +134,41 @@ SDL_Window *VideoManager::getWindow() const {
   return m_window;
 }
 
+SoftwareRenderer *VideoManager::getSoftwareRenderer() const {
+  return m_softwareRenderer.get();
+}
+
+void VideoManager::clear(const SDL_Color color) {
+  if (m_softwareRenderer != nullptr) {
+    m_softwareRenderer->clear(color);
+    return;
+  }
+
+  SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a);
+  SDL_RenderClear(m_renderer);
+}
+
+void VideoManager::finishFrame() {
+  if (m_softwareRenderer != nullptr) {
+    m_softwareRenderer->flush();
+    return;
+  }
+
+  SDL_RenderFlush(m_renderer);
+}
+
+void VideoManager::present() {
+  if (m_softwareRenderer != nullptr) {
+    m_softwareRenderer->present();
+    return;
+  }
+
+  SDL_RenderPresent(m_renderer);
+}
+
 void VideoManager::cleanup() {
+  m_softwareRenderer.reset();
+
   if (m_renderer != nullptr) {
     SDL_DestroyRenderer(m_renderer);
     m_renderer = nullptr;
@@ -9,7 +9,7 @@ int main(int argc, char *argv[]) {
 #ifndef __EMSCRIPTEN__
   SDL_LogSetAllPriority(SDL_LOG_PRIORITY_VERBOSE);
 #endif
-  auto gameEngine = GameEngine();
+  auto gameEngine = GameEngine(LaunchOptions::parse(argc, argv));
   gameEngine.run();
 
   return 0;
@@ -0,0 +1,45 @@
+#include "../includes/Simulation/StateHasher.hpp"
+
+#include <cstdio>
+#include <exception>
+
+/*
+ * Compares the state hash logs of two runs, as written by `yerb_replay --hashes`, and
+ * reports the first tick and the entities at which they diverge.
+ *
+ * Usage: yerb_hashdiff <first.yhash> <second.yhash>
+ */
+int main(const int argc, char *argv[]) {
+  if (argc != 3) {
+    std::fprintf(stderr, "Usage: %s <first> <second>\n", argv[0]);
+    return 2;
+  }
+
+  try {
+    const std::optional<StateHashDivergence> divergence =
+        StateHashHelpers::findFirstDivergence(argv[1], argv[2]);
+
+    if (!divergence.has_value()) {
+      std::printf("runs are identical\n");
+      return 0;
+    }
+
+    std::printf("first divergence at tick %llu\n",
+                static_cast<unsigned long long>(divergence->tick));
+
+    if (divergence->runLengthDiffers) {
+      std::printf("  one run ended before the other\n");
+    }
+    if (divergence->globalStateDiffers) {
+      std::printf("  score, lives or timers differ\n");
+    }
+    for (const size_t entityId : divergence->entityIds) {
+      std::printf("  entity %zu differs\n", entityId);
+    }
+
+    return 1;
+  } catch (const std::exception &error) {
+    std::fprintf(stderr, "%s\n", error.what());
+    return 2;
+  }
+}
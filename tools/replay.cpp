@@ -0,0 +1,132 @@
+#include "../includes/Configuration/ConfigManager.hpp"
+#include "../includes/Helpers/LogHelpers.hpp"
+#include "../includes/Simulation/InputRecording.hpp"
+#include "../includes/Simulation/StateHasher.hpp"
+#include "../includes/Simulation/TelemetryLog.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+
+/*
+ * Replays an input recording headlessly at maximum speed and checks that it ends in the same
+ * state as the recorded session. With --hashes, the per-tick state hashes are written to a
+ * side file that yerb_hashdiff can compare against another run. With --telemetry, per-tick
+ * counters are logged as they would be in the game; the frame time is the whole tick.
+ *
+ * Usage: yerb_replay <recording> [config.json] [--hashes <file>] [--telemetry <file>]
+ */
+int main(const int argc, char *argv[]) {
+  std::optional<std::filesystem::path> recordingPath;
+  std::optional<std::filesystem::path> hashesPath;
+  std::optional<std::filesystem::path> telemetryPath;
+  std::filesystem::path                configPath = "config/config.json";
+
+  for (int i = 1; i < argc; i++) {
+    const std::string argument = argv[i];
+    if (argument == "--hashes" && i + 1 < argc) {
+      hashesPath = argv[++i];
+    } else if (argument == "--telemetry" && i + 1 < argc) {
+      telemetryPath = argv[++i];
+    } else if (!recordingPath.has_value()) {
+      recordingPath = argument;
+    } else {
+      configPath = argument;
+    }
+  }
+
+  if (!recordingPath.has_value()) {
+    std::fprintf(stderr,
+                 "Usage: %s <recording> [config.json] [--hashes <file>] "
+                 "[--telemetry <file>]\n",
+                 argv[0]);
+    return 2;
+  }
+
+  // Spawning logs are noise at replay speed.
+  LogHelpers::setLogSink([](const LogHelpers::LogLevel level, const std::string &message) {
+    if (level == LogHelpers::LogLevel::ERROR) {
+      std::fprintf(stderr, "%s\n", message.c_str());
+    }
+  });
+
+  try {
+    ConfigManager        configManager(configPath);
+    const InputRecording recording = InputRecording::load(*recordingPath);
+
+    StateHasher                         hasher;
+    std::unique_ptr<StateHashLogWriter> hashLog;
+    std::unique_ptr<TelemetryLogWriter> telemetry;
+    if (hashesPath.has_value()) {
+      hashLog = std::make_unique<StateHashLogWriter>(*hashesPath);
+    }
+    if (telemetryPath.has_value()) {
+      telemetry = std::make_unique<TelemetryLogWriter>(*telemetryPath);
+    }
+
+    auto lastTickTime = std::chrono::steady_clock::now();
+
+    InputReplayer::TickCallback onTick;
+    if (hashLog != nullptr || telemetry != nullptr) {
+      onTick = [&](MainSceneSimulation &simulation) -> void {
+        if (hashLog != nullptr) {
+          hasher.update(simulation);
+          hashLog->write(simulation.getTick(), hasher);
+        }
+        if (telemetry != nullptr) {
+          using std::chrono::microseconds;
+          const auto now      = std::chrono::steady_clock::now();
+          const auto tickTime = static_cast<std::uint32_t>(
+              std::chrono::duration_cast<microseconds>(now - lastTickTime).count());
+          telemetry->write(TelemetryRow::capture(simulation, tickTime, tickTime));
+          lastTickTime = now;
+        }
+      };
+    }
+
+    const auto             startTime = std::chrono::steady_clock::now();
+    const RecordingSummary actual    = InputReplayer::run(recording, configManager, onTick);
+    const auto             endTime   = std::chrono::steady_clock::now();
+    telemetry.reset();
+
+    const RecordingSummary &expected = recording.summary;
+    const double            elapsedMs =
+        std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    std::printf("seed %u, %zu actions, %llu ticks replayed in %.2f ms\n",
+                recording.seed,
+                recording.actions.size(),
+                static_cast<unsigned long long>(actual.tickCount),
+                elapsedMs);
+    std::printf("expected: tick %llu, score %d, lives %d, entities %llu\n",
+                static_cast<unsigned long long>(expected.tickCount),
+                expected.score,
+                expected.lives,
+                static_cast<unsigned long long>(expected.entityCount));
+    std::printf("actual:   tick %llu, score %d, lives %d, entities %llu\n",
+                static_cast<unsigned long long>(actual.tickCount),
+                actual.score,
+                actual.lives,
+                static_cast<unsigned long long>(actual.entityCount));
+
+    if (hashesPath.has_value()) {
+      std::printf("final state hash %016llx written with per-tick hashes to %s\n",
+                  static_cast<unsigned long long>(hasher.getStateHash()),
+                  hashesPath->string().c_str());
+    }
+
+    if (actual != expected) {
+      std::printf("replay diverged from the recording\n");
+      return 1;
+    }
+
+    std::printf("replay matched the recording\n");
+    return 0;
+  } catch (const std::exception &error) {
+    std::fprintf(stderr, "%s\n", error.what());
+    return 2;
+  }
+}
@@ -0,0 +1,75 @@
+#include "../includes/Simulation/TelemetryLog.hpp"
+#include "../includes/Helpers/BinaryIO.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+/*
+ * Summarizes the columns of a telemetry log written with --telemetry. Columns are scanned in
+ * place in the memory-mapped file.
+ *
+ * Usage: yerb_telemetry <log> [column...]
+ */
+int main(const int argc, char *argv[]) {
+  if (argc < 2) {
+    std::fprintf(stderr, "Usage: %s <log> [column...]\n", argv[0]);
+    return 2;
+  }
+
+  try {
+    const TelemetryLogReader        reader(argv[1]);
+    const std::vector<std::string> &columnNames = reader.getColumnNames();
+
+    std::vector<size_t> columns;
+    for (int i = 2; i < argc; i++) {
+      const size_t column = reader.findColumn(argv[i]);
+      if (column == columnNames.size()) {
+        std::fprintf(stderr, "No column named %s\n", argv[i]);
+        return 2;
+      }
+      columns.push_back(column);
+    }
+    if (columns.empty()) {
+      for (size_t column = 0; column < columnNames.size(); column++) {
+        columns.push_back(column);
+      }
+    }
+
+    std::printf("%zu rows in %zu blocks\n", reader.getRowCount(), reader.getBlockCount());
+    std::printf("%-24s %12s %12s %12s\n", "column", "min", "mean", "max");
+
+    for (const size_t column : columns) {
+      std::uint32_t minimum = std::numeric_limits<std::uint32_t>::max();
+      std::uint32_t maximum = 0;
+      std::uint64_t total   = 0;
+      std::uint64_t count   = 0;
+
+      for (size_t block = 0; block < reader.getBlockCount(); block++) {
+        for (const std::uint32_t value : reader.getColumn(block, column)) {
+          minimum = std::min(minimum, value);
+          maximum = std::max(maximum, value);
+          total += value;
+        }
+        count += reader.getColumn(block, column).size();
+      }
+
+      if (count == 0) {
+        std::printf("%-24s %12s %12s %12s\n", columnNames[column].c_str(), "-", "-", "-");
+        continue;
+      }
+
+      std::printf("%-24s %12u %12.2f %12u\n",
+                  columnNames[column].c_str(),
+                  minimum,
+                  static_cast<double>(total) / static_cast<double>(count),
+                  maximum);
+    }
+    return 0;
+  } catch (const BinaryFormatError &error) {
+    std::fprintf(stderr, "%s\n", error.what());
+    return 2;
+  }
+}